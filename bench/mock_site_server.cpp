@@ -0,0 +1,385 @@
+// Local stand-in for the ROM sites, for end-to-end timing without the network. Serves the
+// hand-written pages in bench/fixtures (picked by bench/fixtures/routes.txt), a cover image for any
+// image url and a generated zip for any archive url, with injected latency, bandwidth limits
+// and failures. Point the app at it with PLUNDER_BASE_URL, which sends every request to
+// <base>/<original host><original path>:
+//
+//   make mock-server
+//   build/bench/mock_site_server --latency 120 --jitter 60 --bandwidth 800 --fail 0.05
+//   PLUNDER_BASE_URL=http://127.0.0.1:8480 PLUNDER_SCENARIO=bench/scenarios/browse.txt ./Plunder
+//
+// Options (all optional):
+//   --port N          listen port (8480)
+//   --root DIR        fixture directory holding routes.txt (bench/fixtures)
+//   --latency MS      delay before each response (0)
+//   --jitter MS       extra uniformly random delay, 0..MS (0)
+//   --bandwidth KBPS  per-connection body rate, 0 = unlimited (0)
+//   --fail P          probability of answering 503 (0)
+//   --drop P          probability of closing the connection without answering (0)
+//   --image-kb N      pad the cover image to about N KB, like real box art (40)
+//   --zip-kb N        size of the file inside generated archives (2048)
+//   --seed N          random seed, so failure patterns repeat between runs (1)
+//   --quiet           no per-request log
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+struct Options {
+    int port = 8480;
+    std::string root = "bench/fixtures";
+    int latencyMs = 0;
+    int jitterMs = 0;
+    int bandwidthKBps = 0;
+    double failRate = 0.0;
+    double dropRate = 0.0;
+    int imageKB = 40;
+    int zipKB = 2048;
+    unsigned seed = 1;
+    bool quiet = false;
+};
+
+struct Route {
+    std::string host;             // "*" matches any host
+    std::regex path;
+    std::string body;             // fixture path or @204 / @image / @zip
+};
+
+struct Reply {
+    int status = 404;
+    std::string contentType = "text/plain";
+    const std::string* body = nullptr;
+};
+
+Options opts;
+std::vector<Route> routes;
+std::map<std::string, std::string> bodies;    // fixture path -> contents, loaded at startup
+std::string imageBody;
+std::string zipBody;
+const std::string emptyBody;
+const std::string notFoundBody = "no route\n";
+const std::string failBody = "injected failure\n";
+
+std::mutex rngMutex;
+std::mt19937 rng;
+std::atomic<unsigned long> served{0}, failed{0}, dropped{0};
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream ss;
+    ss << in.rdbuf();
+    out = ss.str();
+    return true;
+}
+
+uint32_t crc32(const std::string& data, uint32_t crc = 0) {
+    static uint32_t table[256];
+    static bool ready = false;
+    if (!ready) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        ready = true;
+    }
+    crc = ~crc;
+    for (unsigned char ch : data) crc = table[(crc ^ ch) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void put16(std::string& s, uint16_t v) { s += (char)(v & 0xFF); s += (char)(v >> 8); }
+void put32(std::string& s, uint32_t v) { put16(s, (uint16_t)(v & 0xFFFF)); put16(s, (uint16_t)(v >> 16)); }
+void putBE32(std::string& s, uint32_t v) { for (int i = 3; i >= 0; --i) s += (char)((v >> (i * 8)) & 0xFF); }
+
+// Single stored (uncompressed) entry, enough for the extract path to run end to end
+std::string makeZip(const std::string& name, size_t size) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; ++i) data[i] = (char)((i * 2654435761u) >> 24);
+    uint32_t crc = crc32(data);
+    std::string zip;
+    put32(zip, 0x04034b50); put16(zip, 10); put16(zip, 0); put16(zip, 0); put16(zip, 0); put16(zip, 0x21);
+    put32(zip, crc); put32(zip, (uint32_t)size); put32(zip, (uint32_t)size); put16(zip, (uint16_t)name.size()); put16(zip, 0);
+    zip += name;
+    zip += data;
+    uint32_t central = (uint32_t)zip.size();
+    put32(zip, 0x02014b50); put16(zip, 20); put16(zip, 10); put16(zip, 0); put16(zip, 0); put16(zip, 0); put16(zip, 0x21);
+    put32(zip, crc); put32(zip, (uint32_t)size); put32(zip, (uint32_t)size); put16(zip, (uint16_t)name.size());
+    put16(zip, 0); put16(zip, 0); put16(zip, 0); put16(zip, 0); put32(zip, 0); put32(zip, 0);
+    zip += name;
+    uint32_t centralSize = (uint32_t)zip.size() - central;
+    put32(zip, 0x06054b50); put16(zip, 0); put16(zip, 0); put16(zip, 1); put16(zip, 1);
+    put32(zip, centralSize); put32(zip, central); put16(zip, 0);
+    return zip;
+}
+
+// Grow a PNG to roughly targetBytes with an ancillary chunk decoders skip, so transfers cost
+// what real box art does while the fixture stays tiny
+std::string padPng(const std::string& png, size_t targetBytes) {
+    const size_t iendSize = 12;
+    if (png.size() < 8 + iendSize || targetBytes <= png.size() + iendSize) return png;
+    std::string payload(targetBytes - png.size() - iendSize, 'x');
+    std::string chunk;
+    putBE32(chunk, (uint32_t)payload.size());
+    std::string typed = "plPd" + payload;
+    chunk += typed;
+    putBE32(chunk, crc32(typed));
+    std::string out = png.substr(0, png.size() - iendSize);
+    return out + chunk + png.substr(png.size() - iendSize);
+}
+
+bool loadRoutes() {
+    std::ifstream in(opts.root + "/routes.txt");
+    if (!in) {
+        printf("[MockServer] cannot read %s/routes.txt\n", opts.root.c_str());
+        return false;
+    }
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        std::istringstream fields(line);
+        Route r;
+        std::string pattern;
+        if (!(fields >> r.host) || r.host[0] == '#') continue;
+        if (!(fields >> pattern >> r.body)) {
+            printf("[MockServer] routes.txt:%d: expected <host> <pattern> <body>\n", lineNo);
+            return false;
+        }
+        try {
+            r.path = std::regex(pattern, std::regex::ECMAScript | std::regex::optimize);
+        } catch (const std::regex_error& e) {
+            printf("[MockServer] routes.txt:%d: bad pattern %s (%s)\n", lineNo, pattern.c_str(), e.what());
+            return false;
+        }
+        if (r.body[0] != '@' && !bodies.count(r.body)) {
+            std::string contents;
+            if (!readFile(opts.root + "/" + r.body, contents)) {
+                printf("[MockServer] routes.txt:%d: missing fixture %s\n", lineNo, r.body.c_str());
+                return false;
+            }
+            bodies[r.body] = std::move(contents);
+        }
+        routes.push_back(std::move(r));
+    }
+    return true;
+}
+
+Reply route(const std::string& host, const std::string& path) {
+    Reply reply;
+    reply.body = &notFoundBody;
+    for (const Route& r : routes) {
+        if (r.host != "*" && r.host != host) continue;
+        if (!std::regex_search(path, r.path)) continue;
+        reply.status = 200;
+        if (r.body == "@204") {
+            reply.status = 204;
+            reply.body = &emptyBody;
+        } else if (r.body == "@image") {
+            reply.contentType = "image/png";
+            reply.body = &imageBody;
+        } else if (r.body == "@zip") {
+            reply.contentType = "application/zip";
+            reply.body = &zipBody;
+        } else {
+            reply.contentType = "text/html; charset=UTF-8";
+            reply.body = &bodies.find(r.body)->second;
+        }
+        break;
+    }
+    return reply;
+}
+
+double random01() {
+    std::lock_guard<std::mutex> lock(rngMutex);
+    return std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+}
+
+bool sendAll(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// Body in 4 KB slices paced to the bandwidth limit
+bool sendBody(int fd, const std::string& body) {
+    if (opts.bandwidthKBps <= 0) return sendAll(fd, body.data(), body.size());
+    const size_t slice = 4096;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t sent = 0; sent < body.size();) {
+        size_t n = std::min(slice, body.size() - sent);
+        if (!sendAll(fd, body.data() + sent, n)) return false;
+        sent += n;
+        auto due = start + std::chrono::microseconds((long long)(sent * 1000000.0 / (opts.bandwidthKBps * 1024.0)));
+        std::this_thread::sleep_until(due);
+    }
+    return true;
+}
+
+const char* reason(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 503: return "Service Unavailable";
+        default: return "Unknown";
+    }
+}
+
+void serveConnection(int fd) {
+    std::string buffer;
+    char chunk[8192];
+    for (;;) {
+        size_t headerEnd;
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) { close(fd); return; }
+            buffer.append(chunk, (size_t)n);
+        }
+        std::string head = buffer.substr(0, headerEnd);
+        buffer.erase(0, headerEnd + 4); // GET/HEAD only: no request bodies to skip
+        auto started = std::chrono::steady_clock::now();
+
+        std::istringstream requestLine(head.substr(0, head.find("\r\n")));
+        std::string method, target;
+        requestLine >> method >> target;
+        std::string lowerHead = head;
+        std::transform(lowerHead.begin(), lowerHead.end(), lowerHead.begin(), ::tolower);
+        bool keepAlive = lowerHead.find("connection: close") == std::string::npos;
+
+        // /<host><path>: the first segment is the host the app originally asked for
+        std::string host, path = "/";
+        if (target.size() > 1 && target[0] == '/') {
+            size_t slash = target.find_first_of("/?", 1);
+            host = target.substr(1, slash == std::string::npos ? std::string::npos : slash - 1);
+            if (slash != std::string::npos) path = target[slash] == '/' ? target.substr(slash) : "/" + target.substr(slash);
+        }
+        Reply reply = route(host, path);
+
+        int delay = opts.latencyMs + (opts.jitterMs > 0 ? (int)(random01() * opts.jitterMs) : 0);
+        if (delay > 0) std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        if (opts.dropRate > 0 && random01() < opts.dropRate) {
+            dropped++;
+            if (!opts.quiet) printf("[MockServer] drop %s%s\n", host.c_str(), path.c_str());
+            close(fd);
+            return;
+        }
+        if (opts.failRate > 0 && random01() < opts.failRate) {
+            failed++;
+            reply.status = 503;
+            reply.contentType = "text/plain";
+            reply.body = &failBody;
+        }
+
+        const std::string& body = *reply.body;
+        bool headOnly = method == "HEAD" || reply.status == 204;
+        std::string headers = "HTTP/1.1 " + std::to_string(reply.status) + " " + reason(reply.status) + "\r\n" +
+                              "Content-Type: " + reply.contentType + "\r\n" +
+                              "Cache-Control: no-store\r\n" +
+                              (reply.status == 204 ? std::string() : "Content-Length: " + std::to_string(body.size()) + "\r\n") +
+                              (keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n") + "\r\n";
+        bool ok = sendAll(fd, headers.data(), headers.size()) && (headOnly || sendBody(fd, body));
+        served++;
+        if (!opts.quiet) {
+            long ms = (long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+            printf("[MockServer] %d %s%s %zu bytes %ld ms\n", reply.status, host.c_str(), path.c_str(), headOnly ? 0 : body.size(), ms);
+        }
+        if (!ok || !keepAlive) { close(fd); return; }
+    }
+}
+
+bool parseArgs(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--quiet") { opts.quiet = true; continue; }
+        if (i + 1 >= argc) { printf("[MockServer] missing value for %s\n", arg.c_str()); return false; }
+        const char* value = argv[++i];
+        if (arg == "--port") opts.port = atoi(value);
+        else if (arg == "--root") opts.root = value;
+        else if (arg == "--latency") opts.latencyMs = atoi(value);
+        else if (arg == "--jitter") opts.jitterMs = atoi(value);
+        else if (arg == "--bandwidth") opts.bandwidthKBps = atoi(value);
+        else if (arg == "--fail") opts.failRate = atof(value);
+        else if (arg == "--drop") opts.dropRate = atof(value);
+        else if (arg == "--image-kb") opts.imageKB = atoi(value);
+        else if (arg == "--zip-kb") opts.zipKB = atoi(value);
+        else if (arg == "--seed") opts.seed = (unsigned)strtoul(value, nullptr, 10);
+        else { printf("[MockServer] unknown option %s\n", arg.c_str()); return false; }
+    }
+    return true;
+}
+
+volatile sig_atomic_t stopRequested = 0;
+void onSignal(int) { stopRequested = 1; }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    if (!parseArgs(argc, argv) || !loadRoutes()) return 1;
+    rng.seed(opts.seed);
+    std::string cover;
+    if (!readFile(opts.root + "/cover.png", cover)) {
+        printf("[MockServer] missing %s/cover.png\n", opts.root.c_str());
+        return 1;
+    }
+    imageBody = padPng(cover, (size_t)std::max(0, opts.imageKB) * 1024);
+    zipBody = makeZip("game.bin", (size_t)std::max(0, opts.zipKB) * 1024);
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((uint16_t)opts.port);
+    if (listener < 0 || bind(listener, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listener, 64) != 0) {
+        printf("[MockServer] cannot listen on 127.0.0.1:%d: %s\n", opts.port, strerror(errno));
+        return 1;
+    }
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onSignal; // no SA_RESTART, so accept() returns on Ctrl+C
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+    printf("[MockServer] %zu routes, listening on http://127.0.0.1:%d (latency %d+%d ms, %d KB/s, fail %.2f, drop %.2f)\n",
+           routes.size(), opts.port, opts.latencyMs, opts.jitterMs, opts.bandwidthKBps, opts.failRate, opts.dropRate);
+
+    while (!stopRequested) {
+        int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) continue;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        std::thread(serveConnection, fd).detach();
+    }
+    close(listener);
+    printf("[MockServer] served %lu responses (%lu failed), dropped %lu connections\n",
+           served.load(), failed.load(), dropped.load());
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Per-page cost of the regex work left after HTML parsing: console-name normalization for the
+// blacklist, /roms/ path extraction and numeric entity decoding. "before" compiles every pattern
+// at the call site like the scrapers used to; "after" uses the shared Patterns registry and the
+// single-pass entity decoder in cleanHtmlText.
+//
+//   make bench
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "src/utils/include/Patterns.h"
+#include "src/utils/include/StringUtils.h"
+
+namespace {
+
+std::string normalizeBefore(const std::string& name) {
+    std::string s = name;
+    s = std::regex_replace(s, std::regex(R"(\s*\([^)]*\))"), "");
+    s = std::regex_replace(s, std::regex(R"(\s*\[[^\]]*\])"), "");
+    s = std::regex_replace(s, std::regex(R"(ROMs?|ISO|&amp;|&|\s{2,})", std::regex::icase), " ");
+    s = std::regex_replace(s, std::regex(R"(^\s+|\s+$)"), "");
+    std::transform(s.begin(), s.end(), s.begin(), ::tolower);
+    s = std::regex_replace(s, std::regex(R"(\s{2,})"), " ");
+    return s;
+}
+
+std::string consolePathBefore(const std::string& url) {
+    std::smatch m;
+    if (std::regex_search(url, m, std::regex(R"(/roms/([^/?]+))"))) return "/roms/" + m[1].str();
+    return "";
+}
+
+size_t decodeEntitiesBefore(std::string s) {
+    std::smatch m;
+    std::regex numEntity(R"(&#(\d+);)");
+    while (std::regex_search(s, m, numEntity)) s.replace(m.position(0), m.length(0), "?");
+    std::regex hexEntity(R"(&#x([0-9A-Fa-f]+);)");
+    while (std::regex_search(s, m, hexEntity)) s.replace(m.position(0), m.length(0), "?");
+    return s.size();
+}
+
+// One listing page: ~40 cards with a label, url and title, plus the console list blacklist pass
+struct Page {
+    std::vector<std::string> labels;
+    std::vector<std::string> urls;
+    std::vector<std::string> titles;
+};
+
+Page makePage() {
+    Page page;
+    const char* consoles[] = {"Game Boy Advance (1234)", "Nintendo DS ROMs", "PlayStation [PSX] ISO", "Sega Genesis &amp; Mega Drive"};
+    for (int i = 0; i < 40; ++i) {
+        page.labels.push_back(consoles[i % 4]);
+        page.urls.push_back("https://www.gamulator.com/roms/game-boy-advance/title-" + std::to_string(i));
+        page.titles.push_back("Pok&#233;mon &#8211; Edition " + std::to_string(i) + " &#x27;Deluxe&#x27;");
+    }
+    return page;
+}
+
+template <typename F>
+double microsPerPage(int pages, F parse) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < pages; ++i) parse();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / pages;
+}
+
+} // namespace
+
+int main() {
+    const int pages = 200;
+    Page page = makePage();
+    size_t sink = 0;
+
+    Patterns::precompile();
+    double before = microsPerPage(pages, [&] {
+        for (const auto& s : page.labels) sink += normalizeBefore(s).size();
+        for (const auto& s : page.urls) sink += consolePathBefore(s).size();
+        for (const auto& s : page.titles) sink += decodeEntitiesBefore(s);
+    });
+    double after = microsPerPage(pages, [&] {
+        for (const auto& s : page.labels) sink += StringUtils::normalizeConsoleName(s).size();
+        for (const auto& s : page.urls) sink += StringUtils::romsConsolePath(s).size();
+        for (const auto& s : page.titles) sink += StringUtils::cleanHtmlText(s).size();
+    });
+
+    printf("regex work per page (%d pages): before %.1f us, after %.1f us (%.1fx)\n", pages, before, after, before / after);
+    return sink == 0;
+}
@@ -0,0 +1,174 @@
+// Parser cost of every site scraper against the pages in bench/fixtures/<site>/*.html: console
+// index, game listing, search results, details and download pages. HttpUtils is replaced by a
+// fixture server below, so this runs on the host without network or SDL. For each page it
+// reports median and best parse time, heap allocations and bytes per parse, and how many
+// items were extracted; a page that yields nothing fails the run.
+//
+// The fixtures are hand-written, not captured from the sites: each mimics its site's markup
+// as the scrapers read it, padded with head/nav/footer weight. They measure parser cost and
+// catch regressions between parser versions, but not changes on the live sites.
+//
+//   make bench                       (from the repo root; the scrapers read res/blacklist.txt)
+//   build/bench/scraper_bench 500    (iterations per page, default 200)
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "src/utils/include/HttpUtils.h"
+#include "src/utils/include/Patterns.h"
+#include "src/scraper/Gamulator/include/GamulatorScraper.h"
+#include "src/scraper/Gamulator/include/GamulatorScraperDownload.h"
+#include "src/scraper/Hexrom/include/HexromScraper.h"
+#include "src/scraper/Hexrom/include/HexromScraperDownload.h"
+#include "src/scraper/Romspedia/include/RomspediaScraper.h"
+#include "src/scraper/Romspedia/include/RomspediaScraperDownload.h"
+
+// --- Allocation counting -------------------------------------------------------------------
+namespace {
+unsigned long allocCount = 0;
+unsigned long allocBytes = 0;
+
+void* countedAlloc(size_t size) {
+    allocCount++;
+    allocBytes += size;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+}
+
+// new[] allocates directly instead of through operator new, or GCC pairs delete[] with
+// operator new and warns (-Wmismatched-new-delete)
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// --- Fixture server ------------------------------------------------------------------------
+namespace {
+std::string currentPage; // body served for every request of the running case
+unsigned long requests = 0;
+}
+
+namespace HttpUtils {
+    std::string fetchWebContent(const std::string&) {
+        requests++;
+        return currentPage;
+    }
+    bool downloadImage(const std::string&, const std::string&) { return false; }
+    bool downloadFile(const std::string&, const std::string&) { return false; }
+    bool hasInternet() { return false; }
+}
+
+namespace {
+
+struct Case {
+    const char* site;
+    const char* page;
+    const char* fixture;            // relative to bench/fixtures
+    std::function<size_t()> parse;  // returns the number of items extracted
+};
+
+size_t detailItems(const GameDetails& d) {
+    size_t n = 0;
+    for (const std::string* s : {&d.title, &d.iconUrl, &d.genre, &d.fileSize, &d.releaseDate, &d.downloads,
+                                 &d.about, &d.language, &d.consoleName, &d.downloadUrl}) {
+        if (!s->empty()) n++;
+    }
+    return n;
+}
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream ss;
+    ss << in.rdbuf();
+    out = ss.str();
+    return true;
+}
+
+// The scrapers log every request; keep that out of the report (but not out of the timing)
+struct QuietStdout {
+    int saved;
+    QuietStdout() {
+        fflush(stdout);
+        saved = dup(1);
+        int devnull = open("/dev/null", O_WRONLY);
+        dup2(devnull, 1);
+        close(devnull);
+    }
+    ~QuietStdout() {
+        fflush(stdout);
+        dup2(saved, 1);
+        close(saved);
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int iterations = argc > 1 ? std::max(1, atoi(argv[1])) : 200;
+    Patterns::precompile();
+
+    GamulatorScraper gamulator;
+    HexromScraper hexrom;
+    RomspediaScraper romspedia;
+    std::vector<Case> cases = {
+        {"gamulator", "consoles", "gamulator/consoles.html", [&] { return gamulator.fetchConsoles().size(); }},
+        {"gamulator", "listing", "gamulator/listing.html", [&] { return gamulator.fetchGames("https://www.gamulator.com/roms/gba", 1).first.size(); }},
+        {"gamulator", "search", "gamulator/search.html", [&] { return gamulator.fetchGames("https://www.gamulator.com/search?search_term_string=mario", 1).first.size(); }},
+        {"gamulator", "details", "gamulator/details.html", [&] { return detailItems(gamulator.fetchGameDetails("https://www.gamulator.com/roms/gba/pokemon-emerald")); }},
+        {"gamulator", "download", "gamulator/download.html", [&] { return (size_t)!ExtractGamulatorDirectDownloadLink("https://www.gamulator.com/roms/gba/pokemon-emerald/download").empty(); }},
+        {"hexrom", "consoles", "hexrom/consoles.html", [&] { return hexrom.fetchConsoles().size(); }},
+        {"hexrom", "listing", "hexrom/listing.html", [&] { return hexrom.fetchGames("https://hexrom.com/roms/gba/", 1).first.size(); }},
+        {"hexrom", "search", "hexrom/search.html", [&] { return hexrom.fetchGames("https://hexrom.com/page/1/?s=zelda", 1).first.size(); }},
+        {"hexrom", "details", "hexrom/details.html", [&] { return detailItems(hexrom.fetchGameDetails("https://hexrom.com/the-legend-of-zelda-the-minish-cap/")); }},
+        {"hexrom", "download", "hexrom/download.html", [&] { return (size_t)!ExtractHexromDirectDownloadLink("https://hexrom.com/the-legend-of-zelda-the-minish-cap/").empty(); }},
+        {"romspedia", "consoles", "romspedia/consoles.html", [&] { return romspedia.fetchConsoles().size(); }},
+        {"romspedia", "listing", "romspedia/listing.html", [&] { return romspedia.fetchGames("https://www.romspedia.com/roms/gba", 1).first.size(); }},
+        {"romspedia", "search", "romspedia/search.html", [&] { return romspedia.fetchGames("https://www.romspedia.com/search?search_term_string=zelda", 1).first.size(); }},
+        {"romspedia", "details", "romspedia/details.html", [&] { return detailItems(romspedia.fetchGameDetails("https://www.romspedia.com/roms/gba/the-legend-of-zelda-the-minish-cap")); }},
+        {"romspedia", "download", "romspedia/download.html", [&] { return (size_t)!ExtractRomspediaDirectDownloadLink("https://www.romspedia.com/roms/gba/the-legend-of-zelda-the-minish-cap").empty(); }},
+    };
+
+    printf("%-10s %-9s %7s %6s %10s %10s %9s %10s\n", "site", "page", "html KB", "items", "median us", "best us", "allocs", "alloc KB");
+    int failures = 0;
+    for (const Case& c : cases) {
+        if (!readFile(std::string("bench/fixtures/") + c.fixture, currentPage)) {
+            printf("%-10s %-9s missing fixture bench/fixtures/%s\n", c.site, c.page, c.fixture);
+            failures++;
+            continue;
+        }
+        size_t items = 0;
+        std::vector<double> micros(iterations);
+        unsigned long allocs = 0, bytes = 0;
+        {
+            QuietStdout quiet;
+            items = c.parse(); // warm-up: blacklist files, regex and parser statics
+            unsigned long allocsBefore = allocCount, bytesBefore = allocBytes;
+            for (int i = 0; i < iterations; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                c.parse();
+                micros[i] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            }
+            allocs = (allocCount - allocsBefore) / iterations;
+            bytes = (allocBytes - bytesBefore) / iterations;
+        }
+        std::sort(micros.begin(), micros.end());
+        printf("%-10s %-9s %7.1f %6zu %10.1f %10.1f %9lu %10.1f%s\n", c.site, c.page, currentPage.size() / 1024.0, items,
+               micros[micros.size() / 2], micros.front(), allocs, bytes / 1024.0, items ? "" : "  <- nothing extracted");
+        if (!items) failures++;
+    }
+    printf("%d iterations per page, %lu fixture requests\n", iterations, requests);
+    return failures ? 1 : 0;
+}
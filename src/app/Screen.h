@@ -9,4 +9,7 @@ public:
     virtual ~Screen() {}
     virtual void render(SDL_Renderer* renderer, TTF_Font* font) = 0;
     virtual void handleInput(const SDL_Event& e, MenuSystem& menuSystem) = 0;
+    // The main loop only redraws after input or an async event; screens return true while they
+    // still need frames on their own (easing, spinners, held sticks, pending texture uploads)
+    virtual bool isAnimating() { return false; }
 };
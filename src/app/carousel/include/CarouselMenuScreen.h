@@ -55,6 +55,7 @@ public:
     void render(SDL_Renderer* renderer, TTF_Font* font) override;
     void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
     bool update();
+    bool isAnimating() override { return animSelectedIndex != (float)selectedIndex || animVelocity != 0.0f; }
 
     // Getter for items
     const std::vector<CarouselMenuItem>& getItems() const { return items; }
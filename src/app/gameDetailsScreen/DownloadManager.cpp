@@ -6,14 +6,17 @@ DownloadManager::DownloadManager() {
     downloadCancelRequested = false;
     downloadCurrentBytes = 0;
     downloadTotalBytes = 0;
-    downloadPid = -1;
     downloadButtonFocus = 0;
 }
 
 DownloadManager::~DownloadManager() {
+    lifetime.cancel();
     if (downloadInProgress) {
         cancelDownload();
     }
+    std::unique_lock<std::mutex> lock(gate->mutex);
+    gate->closed = true;
+    gate->idle.wait(lock, [this] { return !gate->running; });
 }
 
 void DownloadManager::startDownload(const std::string& url, const std::string& outPath, const GameDetails& details) {
@@ -26,17 +29,44 @@ void DownloadManager::startDownload(const std::string& url, const std::string& o
     downloadCurrentBytes = 0;
     downloadTotalBytes = 0;
     
-    // Start download in background thread
-    std::thread(&DownloadManager::downloadWorker, this, url, outPath, details).detach();
+    // Long-running, so it queues behind anything the user is waiting on
+    std::shared_ptr<WorkerGate> workerGate = gate;
+    TaskPool::CancelToken token = lifetime;
+    TaskPool::submit(TaskPool::Priority::Background, lifetime, [this, workerGate, token, url, outPath, details]() {
+        {
+            std::lock_guard<std::mutex> lock(workerGate->mutex);
+            if (workerGate->closed) return;
+            workerGate->running = true;
+        }
+        bool downloaded = downloadWorker(url, outPath);
+        {
+            std::lock_guard<std::mutex> lock(workerGate->mutex);
+            workerGate->running = false;
+            workerGate->idle.notify_all();
+        }
+        if (downloaded) {
+            // Moving and unzipping can take a while and cannot be interrupted, so it runs
+            // without holding the gate: the destructor does not wait for it, and results are
+            // written back only while this object is still around
+            auto status = [this, workerGate](const std::string& text) {
+                std::lock_guard<std::mutex> lock(workerGate->mutex);
+                if (!workerGate->closed) downloadProgressText = text;
+            };
+            Finalized result = finalizeDownload(outPath, details, status);
+            std::lock_guard<std::mutex> lock(workerGate->mutex);
+            if (!workerGate->closed) {
+                downloadProgressText = result.text;
+                if (!result.path.empty()) downloadOutPath = result.path;
+                downloadInProgress = false;
+            }
+        }
+        TaskPool::post(token, [this]() { if (onFinished) onFinished(); });
+    });
 }
 
 void DownloadManager::cancelDownload() {
     downloadCancelRequested = true;
     downloadInProgress = false;
-    if (downloadPid > 0) {
-        kill(downloadPid, SIGTERM);
-        downloadPid = -1;
-    }
     downloadProgressText = "Download canceled.";
     downloadTotalBytes = 0;
     downloadCurrentBytes = 0;
@@ -48,183 +78,188 @@ void DownloadManager::cancelDownload() {
     }
 }
 
-void DownloadManager::downloadWorker(const std::string& url, const std::string& outPath, const GameDetails& details) {
-    // Try to discover size (HEAD)
-    long size = getRemoteFileSize(url);
-    if (size > 0) downloadTotalBytes = size;
-    
+bool DownloadManager::downloadWorker(const std::string& url, const std::string& outPath) {
     std::string referer = url.find("gamulator.com") != std::string::npos ? "https://www.gamulator.com/" : "https://hexrom.com/";
-    
-    // Fork & exec curl so we can poll file size
-    pid_t pid = fork();
-    if (pid == 0) {
-        // Child
-        execlp("curl", "curl",
-               "--globoff", "-L", "--retry", "2",
-               "--cacert", "/etc/ssl/certs/ca-certificates.crt",
-               "-A", "Mozilla/5.0 (X11; Linux x86_64)",
-               "-e", referer.c_str(),
-               "-o", outPath.c_str(),
-               url.c_str(),
-               (char*)nullptr);
-        _exit(127);
-    } else if (pid < 0) {
-        downloadProgressText = "Failed to fork.";
-        downloadInProgress = false;
-        return;
-    }
-    
-    downloadPid = pid;
-    
-    // Parent: poll
-    while (true) {
-        if (downloadCancelRequested) {
-            kill(pid, SIGTERM);
+
+    HttpClient::Request req;
+    req.url = url;
+    req.referer = referer;
+    req.timeoutMs = 0; // ROMs can take minutes; cancel goes through the sink instead
+    // Content-Length of the final response replaces the separate HEAD round trip
+    req.onHeaders = [this](const HttpClient::Response& resp) {
+        long size = std::atol(resp.header("Content-Length").c_str());
+        if (resp.ok() && size > 0) downloadTotalBytes = size;
+    };
+
+    Uint32 lastProgressUpdate = 0;
+    HttpClient::Response resp;
+    // Same as the old "curl --retry 2": retry transport failures that wrote nothing yet
+    for (int attempt = 0; attempt < 3 && !downloadCancelRequested; ++attempt) {
+        FILE* file = fopen(outPath.c_str(), "wb");
+        if (!file) {
+            downloadProgressText = "Failed to open output file.";
+            downloadInProgress = false;
+            return false;
         }
-        
-        int status = 0;
-        pid_t r = waitpid(pid, &status, WNOHANG);
-        
-        struct stat st{};
-        if (stat(outPath.c_str(), &st) == 0) {
-            downloadCurrentBytes = st.st_size;
-            if (downloadTotalBytes > 0) {
-                double pct = downloadTotalBytes > 0 ? (double)downloadCurrentBytes / (double)downloadTotalBytes * 100.0 : 0.0;
-                downloadProgressText = humanReadableSize(downloadCurrentBytes) + " / " + humanReadableSize(downloadTotalBytes) + " (" + std::to_string((int)std::round(pct)) + "%)";
-            } else {
-                downloadProgressText = humanReadableSize(downloadCurrentBytes);
+        downloadCurrentBytes = 0;
+        resp = HttpClient::perform(req, [&](const char* data, size_t len) {
+            if (downloadCancelRequested || TaskPool::cancelled()) return false;
+            if (fwrite(data, 1, len, file) != len) return false;
+            downloadCurrentBytes += (long)len;
+            // Progress text is a std::string read by the UI; refresh it at the old poll rate
+            Uint32 now = SDL_GetTicks();
+            if (now - lastProgressUpdate >= 200) {
+                lastProgressUpdate = now;
+                long current = downloadCurrentBytes;
+                long total = downloadTotalBytes;
+                if (total > 0) {
+                    double pct = (double)current / (double)total * 100.0;
+                    downloadProgressText = humanReadableSize(current) + " / " + humanReadableSize(total) + " (" + std::to_string((int)std::round(pct)) + "%)";
+                } else {
+                    downloadProgressText = humanReadableSize(current);
+                }
             }
-        }
-        
-        if (r == pid) break; // finished
-        if (downloadCancelRequested) {
-            downloadProgressText = "Download canceled.";
-            break;
-        }
-        
-        SDL_Delay(200); // sleep a bit
+            return true;
+        });
+        fclose(file);
+        if (resp.status != 0 || downloadCurrentBytes > 0) break;
+        printf("[Download] Attempt %d failed: %s\n", attempt + 1, resp.error.c_str());
     }
-    
+
     // Finalize
     if (downloadCancelRequested) {
         std::remove(outPath.c_str());
-        if (downloadPid > 0) { 
-            kill(downloadPid, SIGTERM); 
-        }
+        downloadProgressText = "Download canceled.";
         downloadInProgress = false;
-        return;
+        return false;
+    }
+    if (!resp.ok()) {
+        printf("[Download] Failed (%d %s): %s\n", resp.status, resp.error.c_str(), url.c_str());
+        std::remove(outPath.c_str());
     }
     
     struct stat stFinal{};
-    if (stat(outPath.c_str(), &stFinal) == 0 && stFinal.st_size > 0) {
-        downloadCurrentBytes = stFinal.st_size;
-        if (downloadTotalBytes == 0) downloadTotalBytes = stFinal.st_size;
+    if (stat(outPath.c_str(), &stFinal) != 0 || stFinal.st_size <= 0) {
+        downloadProgressText = "Download failed.";
+        downloadInProgress = false;
+        return false;
+    }
+    downloadCurrentBytes = stFinal.st_size;
+    if (downloadTotalBytes == 0) downloadTotalBytes = stFinal.st_size;
+    return true;
+}
+
+// Runs on the TaskPool after the download, without access to the manager (see startDownload)
+DownloadManager::Finalized DownloadManager::finalizeDownload(const std::string& outPath, const GameDetails& details,
+                                                             const std::function<void(const std::string&)>& status) {
+    Finalized result;
+    // Attempt relocate using persisted mappedFolder (if any)
+    if (!details.mappedFolder.empty()) {
+        std::vector<std::string> roots = {"/mnt/SDCARD/Roms","/mnt/SDCARD/ROMS","Roms","ROMS","../Roms","../ROMS"};
+        std::string baseDir;
+        struct stat stDir{};
+        for (auto &r : roots) {
+            std::string candidate = r + "/" + details.mappedFolder;
+            if (stat(candidate.c_str(), &stDir) == 0 && S_ISDIR(stDir.st_mode)) { 
+                baseDir = candidate; 
+                break; 
+            }
+        }
         
-        // Attempt relocate using persisted mappedFolder (if any)
-        if (!details.mappedFolder.empty()) {
-            std::vector<std::string> roots = {"/mnt/SDCARD/Roms","/mnt/SDCARD/ROMS","Roms","ROMS","../Roms","../ROMS"};
-            std::string baseDir;
-            struct stat stDir{};
-            for (auto &r : roots) {
-                std::string candidate = r + "/" + details.mappedFolder;
-                if (stat(candidate.c_str(), &stDir) == 0 && S_ISDIR(stDir.st_mode)) { 
-                    baseDir = candidate; 
-                    break; 
-                }
+        if (!baseDir.empty()) {
+            std::string finalFileName = outPath.substr(outPath.find_last_of('/')+1);
+            std::string newPath = baseDir + "/" + finalFileName;
+            bool isZip = false;
+            if (finalFileName.size() > 4) {
+                std::string ext = finalFileName.substr(finalFileName.size()-4);
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+                if (ext == ".zip" || ext == ".rar") isZip = true;
             }
             
-            if (!baseDir.empty()) {
-                std::string finalFileName = outPath.substr(outPath.find_last_of('/')+1);
-                std::string newPath = baseDir + "/" + finalFileName;
-                bool isZip = false;
-                if (finalFileName.size() > 4) {
-                    std::string ext = finalFileName.substr(finalFileName.size()-4);
-                    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-                    if (ext == ".zip" || ext == ".rar") isZip = true;
+            bool unzip = isZip && shouldUnzipForFolder(details.mappedFolder);
+            printf("[Download] Post-processing: file=%s isZip=%d unzip=%d folder=%s\n", finalFileName.c_str(), (int)isZip, (int)unzip, details.mappedFolder.c_str());
+            
+            // B on the details screen after the transfer: nothing has been placed yet, so stop here
+            if (TaskPool::cancelled()) {
+                std::remove(outPath.c_str());
+                result.text = "Download canceled.";
+                return result;
+            }
+            if (unzip) {
+                // Create temp extraction dir
+                std::string tmpDir = baseDir + "/.__extract_tmp";
+                mkdir(tmpDir.c_str(), 0755);
+                
+                // Use busybox/unzip if available; try unzip then 7z
+                auto cmdExists = [](const char* c){ return system((std::string("command -v ") + c + " >/dev/null 2>&1").c_str()) == 0; };
+                bool haveUnzip = cmdExists("unzip");
+                bool have7z = cmdExists("7z");
+                int ret = -1;
+                
+                if (haveUnzip) {
+                    // Show unzip message in UI
+                    status("Unzipping...");
+                    ret = system((std::string("unzip -o \"") + outPath + "\" -d \"" + tmpDir + "\" >/dev/null 2>&1").c_str());
+                }
+                if (ret != 0 && have7z) {
+                    ret = system((std::string("7z x -y \"") + outPath + "\" -o\"" + tmpDir + "\" >/dev/null 2>&1").c_str());
                 }
                 
-                bool unzip = isZip && shouldUnzipForFolder(details.mappedFolder);
-                printf("[Download] Post-processing: file=%s isZip=%d unzip=%d folder=%s\n", finalFileName.c_str(), (int)isZip, (int)unzip, details.mappedFolder.c_str());
+                if (ret != 0) {
+                    printf("[Download] Extraction skipped/failed: unzip=%d 7z=%d ret=%d (keeping zip)\n", haveUnzip?1:0, have7z?1:0, ret);
+                }
                 
-                if (unzip) {
-                    // Create temp extraction dir
-                    std::string tmpDir = baseDir + "/.__extract_tmp";
-                    mkdir(tmpDir.c_str(), 0755);
-                    
-                    // Use busybox/unzip if available; try unzip then 7z
-                    auto cmdExists = [](const char* c){ return system((std::string("command -v ") + c + " >/dev/null 2>&1").c_str()) == 0; };
-                    bool haveUnzip = cmdExists("unzip");
-                    bool have7z = cmdExists("7z");
-                    int ret = -1;
-                    
-                    if (haveUnzip) {
-                        // Show unzip message in UI
-                        downloadProgressText = "Unzipping...";
-                        ret = system((std::string("unzip -o \"") + outPath + "\" -d \"" + tmpDir + "\" >/dev/null 2>&1").c_str());
-                    }
-                    if (ret != 0 && have7z) {
-                        ret = system((std::string("7z x -y \"") + outPath + "\" -o\"" + tmpDir + "\" >/dev/null 2>&1").c_str());
-                    }
-                    
-                    if (ret != 0) {
-                        printf("[Download] Extraction skipped/failed: unzip=%d 7z=%d ret=%d (keeping zip)\n", haveUnzip?1:0, have7z?1:0, ret);
-                    }
-                    
-                    if (ret == 0) {
-                        // Move extracted files into baseDir
-                        DIR* d = opendir(tmpDir.c_str());
-                        if (d) {
-                            struct dirent* de;
-                            while ((de = readdir(d))) {
-                                if (std::string(de->d_name) == "." || std::string(de->d_name) == "..") continue;
-                                std::string from = tmpDir + "/" + de->d_name;
-                                std::string to = baseDir + "/" + de->d_name;
-                                rename(from.c_str(), to.c_str());
-                            }
-                            closedir(d);
-                        }
-                        // Delete original zip
-                        std::remove(outPath.c_str());
-                        // Remove temp dir
-                        rmdir(tmpDir.c_str());
-                        downloadProgressText = std::string("Extracted to ") + baseDir;
-                        printf("[Download] Extracted contents to %s (removed zip)\n", baseDir.c_str());
-                    } else {
-                        // Extraction failed -> attempt plain move of zip
-                        if (rename(outPath.c_str(), newPath.c_str()) == 0) {
-                            downloadOutPath = newPath;
-                            downloadProgressText = std::string("Saved to ") + newPath + " (zip kept)";
-                            printf("[Download] Extraction failed; moved zip to %s\n", newPath.c_str());
-                        } else {
-                            if (std::remove(outPath.c_str()) == 0) printf("[Download] Extraction+move failed; zip deleted %s\n", outPath.c_str());
-                            downloadProgressText = "Download failed (extract+move).";
+                if (ret == 0) {
+                    // Move extracted files into baseDir
+                    DIR* d = opendir(tmpDir.c_str());
+                    if (d) {
+                        struct dirent* de;
+                        while ((de = readdir(d))) {
+                            if (std::string(de->d_name) == "." || std::string(de->d_name) == "..") continue;
+                            std::string from = tmpDir + "/" + de->d_name;
+                            std::string to = baseDir + "/" + de->d_name;
+                            rename(from.c_str(), to.c_str());
                         }
+                        closedir(d);
                     }
+                    // Delete original zip
+                    std::remove(outPath.c_str());
+                    // Remove temp dir
+                    rmdir(tmpDir.c_str());
+                    result.text = std::string("Extracted to ") + baseDir;
+                    printf("[Download] Extracted contents to %s (removed zip)\n", baseDir.c_str());
                 } else {
-                    // Just move the zip or non-zip file
+                    // Extraction failed -> attempt plain move of zip
                     if (rename(outPath.c_str(), newPath.c_str()) == 0) {
-                        downloadOutPath = newPath;
-                        downloadProgressText = std::string("Saved to ") + newPath;
-                        printf("[Download] Moved file to %s\n", newPath.c_str());
+                        result.path = newPath;
+                        result.text = std::string("Saved to ") + newPath + " (zip kept)";
+                        printf("[Download] Extraction failed; moved zip to %s\n", newPath.c_str());
                     } else {
-                        if (std::remove(outPath.c_str()) == 0) printf("[Download] Move failed, file deleted: %s\n", outPath.c_str());
-                        downloadProgressText = "Download failed (move error).";
+                        if (std::remove(outPath.c_str()) == 0) printf("[Download] Extraction+move failed; zip deleted %s\n", outPath.c_str());
+                        result.text = "Download failed (extract+move).";
                     }
                 }
             } else {
-                if (std::remove(outPath.c_str()) == 0) printf("[Download] Console folder missing, file deleted: %s (mappedFolder=%s)\n", outPath.c_str(), details.mappedFolder.c_str());
-                downloadProgressText = "Download failed (console folder missing).";
+                // Just move the zip or non-zip file
+                if (rename(outPath.c_str(), newPath.c_str()) == 0) {
+                    result.path = newPath;
+                    result.text = std::string("Saved to ") + newPath;
+                    printf("[Download] Moved file to %s\n", newPath.c_str());
+                } else {
+                    if (std::remove(outPath.c_str()) == 0) printf("[Download] Move failed, file deleted: %s\n", outPath.c_str());
+                    result.text = "Download failed (move error).";
+                }
             }
         } else {
-            // No mapping persisted -> delete per earlier rule
-            if (std::remove(outPath.c_str()) == 0) printf("[Download] No mapping (persisted empty), file deleted: %s\n", outPath.c_str());
-            downloadProgressText = "Download failed (no console mapping).";
+            if (std::remove(outPath.c_str()) == 0) printf("[Download] Console folder missing, file deleted: %s (mappedFolder=%s)\n", outPath.c_str(), details.mappedFolder.c_str());
+            result.text = "Download failed (console folder missing).";
         }
     } else {
-        downloadProgressText = "Download failed.";
+        // No mapping persisted -> delete per earlier rule
+        if (std::remove(outPath.c_str()) == 0) printf("[Download] No mapping (persisted empty), file deleted: %s\n", outPath.c_str());
+        result.text = "Download failed (no console mapping).";
     }
-    
-    downloadInProgress = false;
+    return result;
 }
 
 std::string DownloadManager::humanReadableSize(long bytes) {
@@ -249,24 +284,17 @@ std::vector<DownloadOption> DownloadManager::scrapeDownloadOptions(const std::st
     if (html.empty()) return result;
     
     // Find the main table with download links
-    std::smatch tableMatch;
-    std::regex tableRe(R"(<table[^>]*>([\s\S]*?)</table>)", std::regex::icase);
-    if (std::regex_search(html, tableMatch, tableRe)) {
-        std::string table = tableMatch[1].str();
-        std::regex rowRe(R"(<tr>([\s\S]*?)</tr>)", std::regex::icase);
-        auto rowsBegin = std::sregex_iterator(table.begin(), table.end(), rowRe);
-        auto rowsEnd = std::sregex_iterator();
-        for (auto it = rowsBegin; it != rowsEnd; ++it) {
-            std::string row = (*it)[1].str();
-            std::smatch linkMatch;
-            std::regex linkRe(R"(<a[^>]+href=["']([^"']+/download/[^"']+)["'][^>]*>([\s\S]*?)</a>)", std::regex::icase);
-            if (std::regex_search(row, linkMatch, linkRe)) {
-                std::string url = linkMatch[1].str();
+    HtmlParser::Element table;
+    if (HtmlParser::find(html, "table", table)) {
+        for (const auto& row : HtmlParser::findAll(table.inner, "tr")) {
+            HtmlParser::Element link;
+            if (HtmlParser::find(row.inner, "a[href*=/download/]", link)) {
+                std::string url = link.open.attr("href").str();
                 // Only prepend romsfun.com for Romsfun, not Hexrom
                 if (url.find("http") != 0 && url.find("/download/") != std::string::npos) {
                     url = "https://hexrom.com" + url;
                 }
-                std::string label = StringUtils::cleanHtmlText(linkMatch[2].str());
+                std::string label = StringUtils::cleanHtmlText(HtmlParser::text(link.inner));
                 result.push_back({label, url});
             }
         }
@@ -277,12 +305,7 @@ std::vector<DownloadOption> DownloadManager::scrapeDownloadOptions(const std::st
 std::string DownloadManager::scrapeFinalDownloadLink(const std::string& versionUrl) {
     std::string html = HttpUtils::fetchWebContent(versionUrl);
     if (html.empty()) return "";
-    std::smatch linkMatch;
-    std::regex linkRe(R"(<a[^>]+id=["']download["'][^>]+href=["']([^"']+)["'])", std::regex::icase);
-    if (std::regex_search(html, linkMatch, linkRe)) {
-        return linkMatch[1].str();
-    }
-    return "";
+    return HtmlParser::attrOf(html, "a#download[href]", "href");
 }
 
 void DownloadManager::downloadFileToDisk(const std::string& url, const std::string& outPath) {
@@ -299,30 +322,15 @@ void DownloadManager::downloadFileToDisk(const std::string& url, const std::stri
 }
 
 long DownloadManager::getRemoteFileSize(const std::string& url) {
-    std::string command = "curl --cacert /etc/ssl/certs/ca-certificates.crt -sI \"" + url + "\"";
-    FILE* pipe = popen(command.c_str(), "r");
-    if (!pipe) return -1;
-    
-    char buffer[256];
-    long size = -1;
-    while (fgets(buffer, sizeof(buffer), pipe)) {
-        std::string line(buffer);
-        // Make case-insensitive and trim whitespace
-        std::string lowerLine = line;
-        std::transform(lowerLine.begin(), lowerLine.end(), lowerLine.begin(), ::tolower);
-        size_t pos = lowerLine.find("content-length:");
-        if (pos != std::string::npos) {
-            std::string val = line.substr(pos + 15);
-            val.erase(0, val.find_first_not_of(" \t\r\n"));
-            val.erase(val.find_last_not_of(" \t\r\n") + 1);
-            try {
-                size = std::stol(val);
-            } catch (...) {
-                size = -1;
-            }
-            break;
-        }
+    HttpClient::Request req;
+    req.method = "HEAD";
+    req.url = url;
+    HttpClient::Response resp = HttpClient::perform(req);
+    if (!resp.ok()) return -1;
+    std::string val = resp.header("Content-Length");
+    try {
+        return std::stol(val);
+    } catch (...) {
+        return -1;
     }
-    pclose(pipe);
-    return size;
-}
\ No newline at end of file
+}
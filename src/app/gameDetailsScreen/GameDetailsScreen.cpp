@@ -1,7 +1,7 @@
 #include "include/GameDetailsScreen.h"
 
-GameDetailsScreen::GameDetailsScreen(const GameDetails& details, SDL_Texture* iconTexture)
-    : details(details), iconTexture(iconTexture) {
+GameDetailsScreen::GameDetailsScreen(const GameDetails& details, SDL_Texture* iconTexture, SDL_Rect iconRect)
+    : details(details), iconTexture(iconTexture), iconSrcRect(iconRect) {
     // Initialize SDL_mixer for cancel sound
     if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) == 0) {
         mixerInitialized = true;
@@ -14,9 +14,15 @@ GameDetailsScreen::GameDetailsScreen(const GameDetails& details, SDL_Texture* ic
     } else {
         printf("[Sound] SDL_mixer init failed: %s\n", Mix_GetError());
     }
+    // Completion popup (the manager posts this on the main thread)
+    downloadManager.onFinished = [this]() {
+        downloadPopupMessage = downloadManager.getProgressText();
+        showDownloadPopup = true;
+    };
 }
 
 GameDetailsScreen::~GameDetailsScreen() {
+    tasks.cancel();
     if (cancelSound) {
         Mix_FreeChunk(cancelSound);
         cancelSound = nullptr;
@@ -141,8 +147,8 @@ void GameDetailsScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     // Check if texture is valid and get dimensions
     bool hasValidTexture = false;
     if (iconTexture) {
-        int texW = 0, texH = 0;
-        SDL_QueryTexture(iconTexture, NULL, NULL, &texW, &texH);
+        int texW = iconSrcRect.w, texH = iconSrcRect.h;
+        if (texW <= 0 || texH <= 0) SDL_QueryTexture(iconTexture, NULL, NULL, &texW, &texH);
         if (texW > 0 && texH > 0) {
             hasValidTexture = true;
             iconH = texH * iconW / texW;
@@ -151,7 +157,8 @@ void GameDetailsScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     // Only create icon rect and render if we have a valid texture
     if (hasValidTexture) {
         SDL_Rect iconRect = {x, y, iconW, iconH};
-        SDL_RenderCopy(renderer, iconTexture, NULL, &iconRect);
+        bool hasSrcRect = iconSrcRect.w > 0 && iconSrcRect.h > 0;
+        SDL_RenderCopy(renderer, iconTexture, hasSrcRect ? &iconSrcRect : NULL, &iconRect);
     }
     
     // Adjust layout based on whether we have a valid image
@@ -283,7 +290,8 @@ void GameDetailsScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     // Animate border progress (smoother)
     Uint32 now = SDL_GetTicks();
     float target = buttonFocused ? 1.0f : 0.0f;
-    float animSpeed = 0.004f * (now - lastAnimTime); // slower for smoother
+    // Frames stop while idle, so cap the step instead of jumping straight to the target
+    float animSpeed = 0.004f * std::min<Uint32>(now - lastAnimTime, 50); // slower for smoother
     if (buttonBorderAnim < target) buttonBorderAnim = std::min(target, buttonBorderAnim + animSpeed);
     if (buttonBorderAnim > target) buttonBorderAnim = std::max(target, buttonBorderAnim - animSpeed);
     lastAnimTime = now;
@@ -423,10 +431,11 @@ void GameDetailsScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem)
                 if (!downloadOptions.empty()) {
                     downloadPopupMessage = "Fetching download link...";
                     std::string versionUrl = downloadOptions[selectedDownloadOption].url;
-                    std::thread([this, versionUrl]() {
-                        std::string finalLink = DownloadManager::scrapeFinalDownloadLink(versionUrl);
+                    TaskPool::run(TaskPool::Priority::Interactive, tasks, [versionUrl]() {
+                        return DownloadManager::scrapeFinalDownloadLink(versionUrl);
+                    }, [this](const std::string& finalLink) {
                         downloadPopupMessage = "Download link: " + finalLink;
-                    }).detach();
+                    });
                 }
                 return;
             }
@@ -538,14 +547,6 @@ void GameDetailsScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem)
             // Start download using DownloadManager
             downloadManager.startDownload(url, downloadOutPath, details);
             
-            // Setup callback to show completion popup
-            std::thread([this]() {
-                while (downloadManager.isDownloading()) {
-                    SDL_Delay(500); // Check every 500ms
-                }
-                downloadPopupMessage = downloadManager.getProgressText();
-                showDownloadPopup = true;
-            }).detach();
             return;
         }
         // Focus/unfocus download button
@@ -1,15 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <thread>
 #include <vector>
 #include <cstdio>
 #include <sys/stat.h>
-#include <sys/wait.h>
 #include <unistd.h>
-#include <csignal>
-#include <regex>
 #include <fstream>
 #include <algorithm>
 #include <dirent.h>
@@ -18,7 +19,10 @@
 
 #include "../../../model/GameDetails.h"
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/HttpClient.h"
 #include "../../../utils/include/StringUtils.h"
+#include "../../../utils/include/HtmlParser.h"
+#include "../../../utils/include/TaskPool.h"
 #include "../../consolePolicies/ConsoleZipPolicy.h"
 
 struct DownloadOption {
@@ -44,11 +48,13 @@ public:
     long getTotalBytes() const { return downloadTotalBytes; }
     std::string getProgressText() const { return downloadProgressText; }
     std::string getOutputPath() const { return downloadOutPath; }
-    pid_t getDownloadPid() const { return downloadPid; }
     
     // Focus management for UI
     int getButtonFocus() const { return downloadButtonFocus; }
     void setButtonFocus(int focus) { downloadButtonFocus = focus; }
+
+    // Called on the main thread once a download has ended (finished, failed or canceled)
+    std::function<void()> onFinished;
     
     // Static utility methods for scraping
     static std::vector<DownloadOption> scrapeDownloadOptions(const std::string& pageUrl);
@@ -56,8 +62,15 @@ public:
     static long getRemoteFileSize(const std::string& url);
     
 private:
-    // Worker thread function
-    void downloadWorker(const std::string& url, const std::string& outPath, const GameDetails& details);
+    // Run on the TaskPool: the transfer (true when a file is ready), then moving/unzipping it
+    // into the console's folder, which returns the final status text and path
+    bool downloadWorker(const std::string& url, const std::string& outPath);
+    struct Finalized {
+        std::string text;
+        std::string path;             // empty unless the file was moved there
+    };
+    static Finalized finalizeDownload(const std::string& outPath, const GameDetails& details,
+                                      const std::function<void(const std::string&)>& status);
     
     // Utility methods
     static std::string humanReadableSize(long bytes);
@@ -69,7 +82,17 @@ private:
     std::atomic<long> downloadCurrentBytes{0};
     std::atomic<long> downloadTotalBytes{0};
     std::string downloadProgressText;
-    pid_t downloadPid = -1;
     std::string downloadOutPath;
     int downloadButtonFocus = 0; // 0 = progress bar, 1 = cancel button
+
+    // Cancelled on destruction. The gate lets the destructor wait out a running transfer and
+    // keeps a worker that has not started yet, or is still finalizing, from touching this object.
+    TaskPool::CancelToken lifetime;
+    struct WorkerGate {
+        std::mutex mutex;
+        std::condition_variable idle;
+        bool running = false;
+        bool closed = false;
+    };
+    std::shared_ptr<WorkerGate> gate = std::make_shared<WorkerGate>();
 };
\ No newline at end of file
@@ -40,21 +40,28 @@
 #include "../../../utils/include/StringUtils.h"
 #include "../../ControllerButtons.h"
 #include "DownloadManager.h"
+#include "../../../utils/include/TaskPool.h"
 
 /// ========================================================== ///
 class MenuSystem;
 
 class GameDetailsScreen : public Screen {
     public:
-        GameDetailsScreen(const GameDetails& details, SDL_Texture* iconTexture = nullptr);
+        // iconRect selects the icon inside iconTexture (an atlas page); empty means the whole texture
+        GameDetailsScreen(const GameDetails& details, SDL_Texture* iconTexture = nullptr, SDL_Rect iconRect = SDL_Rect{0, 0, 0, 0});
         ~GameDetailsScreen();
 
         void render(SDL_Renderer* renderer, TTF_Font* font) override;
         void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
+        // Border easing on the download button, progress bar while downloading
+        bool isAnimating() override {
+            return downloadManager.isDownloading() || buttonBorderAnim != (buttonFocused ? 1.0f : 0.0f);
+        }
 
     private:
         GameDetails details;
         SDL_Texture* iconTexture = nullptr;
+        SDL_Rect iconSrcRect = {0, 0, 0, 0};
         int aboutScrollOffset = 0;
         int aboutMaxVisibleLines = 0;
         bool buttonFocused = false; // True if download button is focused
@@ -80,6 +87,8 @@ class GameDetailsScreen : public Screen {
         
         // Download manager
         DownloadManager downloadManager;
+        // Background lookups for this screen, cancelled when it goes away
+        TaskPool::CancelToken tasks;
     public:
         void setAboutScrollOffset(int offset) { aboutScrollOffset = offset; }
         int getAboutScrollOffset() const { return aboutScrollOffset; }
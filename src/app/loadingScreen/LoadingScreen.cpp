@@ -1,6 +1,10 @@
 #include "include/LoadingScreen.h"
 
-LoadingScreen::LoadingScreen(const std::string& msg) : message(msg) {}
+#include "../menuApp/include/MenuSystem.h"
+#include "../ControllerButtons.h"
+
+LoadingScreen::LoadingScreen(const std::string& msg, const TaskPool::CancelToken& task) : message(msg), task(task) {}
+LoadingScreen::~LoadingScreen() { task.cancel(); }
 void LoadingScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     // Animate loading circle
     frameCounter++;
@@ -22,16 +26,14 @@ void LoadingScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
         int x = centerX + (int)(radius * cos(angle));
         int y = centerY + (int)(radius * sin(angle));
         int alpha = (int)(180 + 75 * fade);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, alpha);
-        for (int dx = -dotRadius; dx <= dotRadius; ++dx) {
-            for (int dy = -dotRadius; dy <= dotRadius; ++dy) {
-                if (dx*dx + dy*dy <= dotRadius*dotRadius) {
-                    SDL_RenderDrawPoint(renderer, x + dx, y + dy);
-                }
-            }
-        }
+        Sprites::drawDisc(renderer, x, y, dotRadius, SDL_Color{255, 255, 255, (Uint8)alpha});
     }
     // Draw loading message below the circle
     UiUtils::RenderTextCentered(renderer, font, message, centerX, centerY + radius + 48, UiUtils::Color(255, 255, 255));
 }
-void LoadingScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) { /* ignore input */ }
\ No newline at end of file
+void LoadingScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
+    if (e.type == SDL_CONTROLLERBUTTONDOWN && e.cbutton.button == BUTTON_B) {
+        task.cancel();
+        menuSystem.popScreen();
+    }
+}
\ No newline at end of file
@@ -9,6 +9,8 @@
 // Other imports
 #include "../../Screen.h"
 #include "../../../utils/include/UiUtils.h"
+#include "../../../utils/include/Sprites.h"
+#include "../../../utils/include/TaskPool.h"
 
 class MenuSystem;
 
@@ -17,10 +19,14 @@ private:
     std::string message;
     int frameCounter = 0;
     int animationFrame = 0;
+    TaskPool::CancelToken task;
 
 public:
-    LoadingScreen(const std::string& message);
+    // task is the work this screen waits for; B (or the screen going away) cancels it
+    LoadingScreen(const std::string& message, const TaskPool::CancelToken& task = TaskPool::CancelToken());
+    ~LoadingScreen();
     
     void render(SDL_Renderer* renderer, TTF_Font* font) override;
     void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
+    bool isAnimating() override { return true; } // spinner
 };
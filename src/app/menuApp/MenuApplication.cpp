@@ -1,12 +1,13 @@
 #include "include/MenuApplication.h"
 
 // ===================== Internal helper structs & constants ===================== //
-struct DetailsWithTexture { GameDetails details; SDL_Texture* texture; };
-enum EventCode { 
-    EVENT_CONSOLES_LOADED = 1, 
-    EVENT_GAMES_LOADED = 2, 
-    EVENT_GAME_DETAILS_LOADED = 3, 
-    EVENT_PATCH_NOTES_LOADED = 99 };
+struct DetailsWithTexture { GameDetails details; SDL_Texture* texture; SDL_Rect textureRect; };
+// Frame pacing: ~60 FPS while something changes, otherwise a slow heartbeat that picks up state
+// set by threads that post no event (download popup, caret blink)
+const Uint32 FRAME_INTERVAL_MS = 16;
+const Uint32 IDLE_REDRAW_MS = 500;
+// Main-loop time per iteration for running background completions (at least one always runs)
+const Uint32 COMPLETION_BUDGET_MS = 4;
 // =============================================================================== //
 
 MenuApplication::MenuApplication() {}
@@ -34,8 +35,11 @@ bool MenuApplication::initialize() {
     }
     initController(); // Ensure controller is initialized
     menuSystem = new MenuSystem(renderer, font);
+    Patterns::precompile(); // shared regexes, built once instead of per parse
+    Profiler::init();
     buildSiteRegistry();
     setupScreens();
+    scenario = ScenarioRunner::fromEnvironment();
     running = true;
     return true;
 }
@@ -43,9 +47,10 @@ bool MenuApplication::initialize() {
 // ===================== Site Registry Helpers ===================== //
 void MenuApplication::buildSiteRegistry() {
     siteRegistry.clear();
-    siteRegistry.push_back({"Hexrom", std::make_shared<HexromScraper>()});
-    siteRegistry.push_back({"Gamulator", std::make_shared<GamulatorScraper>()});
-    siteRegistry.push_back({"Romspedia", std::make_shared<RomspediaScraper>()});
+    // Parsed results are memoized so back-navigation does not refetch or reparse
+    siteRegistry.push_back({"Hexrom", std::make_shared<CachingScraper>(std::make_shared<HexromScraper>())});
+    siteRegistry.push_back({"Gamulator", std::make_shared<CachingScraper>(std::make_shared<GamulatorScraper>())});
+    siteRegistry.push_back({"Romspedia", std::make_shared<CachingScraper>(std::make_shared<RomspediaScraper>())});
 }
 
 std::shared_ptr<SiteScraper> MenuApplication::currentScraper() const {
@@ -63,39 +68,64 @@ void MenuApplication::run() {
     Uint32 lastFrame = SDL_GetTicks();
     bool needsRedraw = true;
     while (running && menuSystem->isRunning()) {
-        while (SDL_PollEvent(&e)) processEvent(e);
+        if (scenario) {
+            bool more = scenario->update(*menuSystem, [this](const std::string& id) {
+                int idx = findSiteIndexById(id);
+                if (idx < 0) return false;
+                openSite((size_t)idx);
+                return true;
+            });
+            if (!more) break;
+            needsRedraw = true; // keep frames coming so the script is polled while it waits
+        }
         updateCurrentScreenAnimations(needsRedraw);
-    Uint32 now = SDL_GetTicks();
-    const Uint32 frameDelay = 16; // fixed ~60 FPS
-    if (needsRedraw || now - lastFrame >= frameDelay) {
+        // Sleep in SDL until input, an async result or the next frame is due
+        Uint32 interval = needsRedraw ? FRAME_INTERVAL_MS : IDLE_REDRAW_MS;
+        Uint32 elapsed = SDL_GetTicks() - lastFrame;
+        int timeout = elapsed >= interval ? 0 : (int)(interval - elapsed);
+        if (timeout > 0 ? SDL_WaitEventTimeout(&e, timeout) : SDL_PollEvent(&e)) {
+            do { processEvent(e); } while (SDL_PollEvent(&e));
+            needsRedraw = true;
+        }
+        // Background results call their handlers below; a burst is spread over several frames
+        {
+            Profiler::Scope scope("TaskPool::drainCompletions");
+            if (TaskPool::drainCompletions(COMPLETION_BUDGET_MS)) needsRedraw = true;
+        }
+        if (!running) break;
+        Uint32 now = SDL_GetTicks();
+        if (now - lastFrame >= (needsRedraw ? FRAME_INTERVAL_MS : IDLE_REDRAW_MS)) {
+            Profiler::beginFrame();
             menuSystem->render();
-            SDL_RenderPresent(renderer);
+            Profiler::drawOverlay(renderer, font);
+            {
+                Profiler::Scope scope("SDL_RenderPresent");
+                SDL_RenderPresent(renderer);
+            }
+            Profiler::endFrame();
             lastFrame = now;
             needsRedraw = false;
         }
-        SDL_Delay(1);
     }
 }
 
 // ===================== Event Processing ===================== //
 void MenuApplication::processEvent(const SDL_Event& e) {
     if (e.type == SDL_QUIT) { running = false; return; }
-    if (e.type == SDL_USEREVENT) {
-        switch (e.user.code) {
-            case EVENT_CONSOLES_LOADED: handleConsolesLoaded(static_cast<std::vector<ListItem>*>(e.user.data1)); return;
-            case EVENT_GAMES_LOADED: handleGamesLoaded(static_cast<GameListData*>(e.user.data1)); return;
-            case EVENT_GAME_DETAILS_LOADED: handleGameDetailsLoaded(static_cast<DetailsWithTexture*>(e.user.data1)); return;
-            case EVENT_PATCH_NOTES_LOADED: handlePatchNotesLoaded(static_cast<std::vector<std::string>*>(e.user.data1)); return;
-            default: break;
-        }
+    if (e.type == ImageFetch::resultEvent()) return; // only wakes the loop; the redraw polls the results
+    // Select + Start toggles the profiler overlay; the combo is not passed on to the screen
+    if (e.type == SDL_CONTROLLERBUTTONDOWN && e.cbutton.button == BUTTON_START && controller &&
+        SDL_GameControllerGetButton(controller, (SDL_GameControllerButton)BUTTON_SELECT)) {
+        Profiler::toggleOverlay();
+        return;
     }
+    if (e.type == TaskPool::completionEvent()) return; // only wakes the loop; completions are drained in run()
     menuSystem->handleInput(e);
 }
 
-void MenuApplication::handleConsolesLoaded(std::vector<ListItem>* consolesPtr) {
-    if (!consolesPtr) return;
+void MenuApplication::handleConsolesLoaded(const std::vector<ListItem>& consoles) {
     auto listScreen = std::make_shared<ListScreen>(
-        "Select Console", currentSite, *consolesPtr, renderer,
+        "Select Console", currentSite, consoles, renderer,
         [this](const ListItem& item) {
             std::string selectedConsoleName = item.label;
             std::string mappedFolder = getFolderForScrapedConsole(selectedConsoleName);
@@ -105,72 +135,65 @@ void MenuApplication::handleConsolesLoaded(std::vector<ListItem>* consolesPtr) {
                 printf("[ConsoleMap] Selected '%s' has NO mapping\n", selectedConsoleName.c_str());
             }
             currentConsoleName = selectedConsoleName; // Set member variable for persistence
-            menuSystem->pushScreen(std::make_shared<LoadingScreen>("Loading games..."));
-            fetchGamesAsync(item.downloadUrl, 1, false);
+            fetchGamesAsync(item.downloadUrl, 1, showLoadingScreen("Loading games..."));
         },
         nullptr,
         PaginationInfo()
     );
     menuSystem->popScreen();
     menuSystem->pushScreen(listScreen);
-    delete consolesPtr;
 }
 
-void MenuApplication::handleGamesLoaded(GameListData* gameData) {
-    if (!gameData) return;
+void MenuApplication::handleGamesLoaded(const GameListData& gameData) {
     auto currentScreen = menuSystem->getCurrentScreen();
     auto listScreen = std::dynamic_pointer_cast<ListScreen>(currentScreen);
-    if (listScreen && gameData->pagination.currentPage > 1) {
+    if (listScreen && gameData.pagination.currentPage > 1) {
         listScreen->setLoadingMore(false);
-        listScreen->appendItems(gameData->games, gameData->pagination);
-        delete gameData;
+        listScreen->appendItems(gameData.games, gameData.pagination);
         return;
     }
-    auto onPageChange = [this, gameData](int page) {
+    std::string baseUrl = gameData.baseUrl;
+    auto onPageChange = [this, baseUrl](int page) {
         auto currentScreen2 = menuSystem->getCurrentScreen();
         auto listScreen2 = std::dynamic_pointer_cast<ListScreen>(currentScreen2);
         if (listScreen2 && page > 1) {
             listScreen2->setLoadingMore(true);
             std::string currentBaseUrl = listScreen2->getCurrentPaginationBaseUrl();
-            fetchGamesAsync(currentBaseUrl, page, false);
+            fetchGamesAsync(currentBaseUrl, page);
         } else {
-            std::string baseUrl = gameData->baseUrl;
-            menuSystem->pushScreen(std::make_shared<LoadingScreen>("Loading page " + std::to_string(page)));
-            fetchGamesAsync(baseUrl, page, true);
+            fetchGamesAsync(baseUrl, page, showLoadingScreen("Loading page " + std::to_string(page)));
         }
     };
     auto newListScreen = std::make_shared<ListScreen>(
-        gameData->title,
+        gameData.title,
         currentSite,
-        gameData->games,
+        gameData.games,
         renderer,
         [](const ListItem&) {},
         onPageChange,
-        gameData->pagination
+        gameData.pagination
     );
     newListScreen->onItemSelected2 = [this, newListScreen](const ListItem& game, int index) {
-        SDL_Texture* iconTexture = index >= 0 ? newListScreen->getTextureAt(index) : nullptr;
-        menuSystem->pushScreen(std::make_shared<LoadingScreen>("Loading game details..."));
-        fetchGameDetailsAsync(game, iconTexture, currentConsoleName);
+        SDL_Rect iconRect = {0, 0, 0, 0};
+        SDL_Texture* iconTexture = index >= 0 ? newListScreen->getTextureAt(index, &iconRect) : nullptr;
+        fetchGameDetailsAsync(game, iconTexture, iconRect, currentConsoleName, showLoadingScreen("Loading game details..."));
+    };
+    std::weak_ptr<ListScreen> weakList = newListScreen;
+    newListScreen->onPrefetchPage = [this, weakList](const std::string& baseUrl, int page, const TaskPool::CancelToken& task) {
+        prefetchGamesAsync(weakList, baseUrl, page, task);
     };
+    newListScreen->onRunQuery = [this, weakList](int ticket, ListScreen::ListQuery query, const TaskPool::CancelToken& task) {
+        runListQueryAsync(weakList, ticket, std::move(query), task);
+    };
+    newListScreen->scraper = currentScraper();
     newListScreen->setTallGridMode(true);
     menuSystem->popScreen();
     menuSystem->pushScreen(newListScreen);
-    delete gameData;
 }
 
-void MenuApplication::handleGameDetailsLoaded(DetailsWithTexture* detailsWithTex) {
-    if (!detailsWithTex) return;
+void MenuApplication::handleGameDetailsLoaded(const DetailsWithTexture& detailsWithTex) {
     menuSystem->popScreen();
-    menuSystem->pushScreen(std::make_shared<GameDetailsScreen>(detailsWithTex->details, detailsWithTex->texture));
-    delete detailsWithTex;
-}
-
-void MenuApplication::handlePatchNotesLoaded(std::vector<std::string>* linesPtr) {
-    auto currentScreen = menuSystem->getCurrentScreen();
-    auto patchScreen = std::dynamic_pointer_cast<PatchNotesScreen>(currentScreen);
-    if (patchScreen && linesPtr) patchScreen->setNotes(*linesPtr);
-    if (linesPtr) delete linesPtr;
+    menuSystem->pushScreen(std::make_shared<GameDetailsScreen>(detailsWithTex.details, detailsWithTex.texture, detailsWithTex.textureRect));
 }
 
 // ===================== Screen / Animation Update ===================== //
@@ -179,70 +202,98 @@ void MenuApplication::updateCurrentScreenAnimations(bool& needsRedraw) {
     if (!currentScreen) return;
     if (auto listScreen = std::dynamic_pointer_cast<ListScreen>(currentScreen)) {
         listScreen->updateAnalogScroll();
-        needsRedraw = true;
     } else if (auto patchScreen = std::dynamic_pointer_cast<PatchNotesScreen>(currentScreen)) {
         patchScreen->update();
-        needsRedraw = true;
     } else if (auto carouselScreen = std::dynamic_pointer_cast<CarouselMenuScreen>(currentScreen)) {
-        if (carouselScreen->update()) needsRedraw = true;
+        carouselScreen->update();
     }
+    if (currentScreen->isAnimating()) needsRedraw = true;
 }
 
 // ===================== Async Fetch Helpers ===================== //
-void MenuApplication::fetchConsolesAsync() {
-    std::thread([this]() {
-        int idx = currentSiteIndex;
-        auto scraper = (idx >= 0 && idx < (int)siteRegistry.size()) ? siteRegistry[idx].scraper : nullptr;
-        auto consoles = scraper ? scraper->fetchConsoles() : std::vector<ListItem>();
-        SDL_Event event; SDL_zero(event);
-        event.type = SDL_USEREVENT; event.user.code = EVENT_CONSOLES_LOADED; event.user.data1 = new std::vector<ListItem>(consoles);
-        SDL_PushEvent(&event);
-    }).detach();
+// Work runs on the shared TaskPool; the lambdas handed to TaskPool::run as completions run on
+// the main thread (drained in run()) unless their token was cancelled first.
+TaskPool::CancelToken MenuApplication::showLoadingScreen(const std::string& message) {
+    TaskPool::CancelToken token;
+    menuSystem->pushScreen(std::make_shared<LoadingScreen>(message, token));
+    return token;
 }
 
+void MenuApplication::fetchConsolesAsync(const TaskPool::CancelToken& token) {
+    auto scraper = currentScraper();
+    TaskPool::run(TaskPool::Priority::Interactive, token, [scraper]() {
+        return scraper ? scraper->fetchConsoles() : std::vector<ListItem>();
+    }, [this](const std::vector<ListItem>& consoles) {
+        handleConsolesLoaded(consoles);
+    });
+}
 
-void MenuApplication::fetchGamesAsync(const std::string& baseUrl, int page, bool showLoadingScreen) {
-    std::thread([this, baseUrl, page]() {
-        auto scraper = currentScraper();
+void MenuApplication::fetchGamesAsync(const std::string& baseUrl, int page, const TaskPool::CancelToken& token) {
+    auto scraper = currentScraper();
+    std::string consoleName = currentConsoleName; // Use member variable for persistence
+    TaskPool::run(TaskPool::Priority::Interactive, token, [scraper, baseUrl, page, consoleName]() {
         auto result = scraper ? scraper->fetchGames(baseUrl, page) : std::make_pair(std::vector<ListItem>(), PaginationInfo());
-        GameListData* gameData = new GameListData();
-        gameData->games = result.first;
-        gameData->pagination = result.second;
-        gameData->title = "Games";
-        gameData->baseUrl = baseUrl;
-        gameData->consoleName = currentConsoleName; // Use member variable for persistence
-        SDL_Event event; SDL_zero(event);
-        event.type = SDL_USEREVENT; event.user.code = EVENT_GAMES_LOADED; event.user.data1 = gameData;
-        SDL_PushEvent(&event);
-    }).detach();
+        GameListData gameData;
+        gameData.games = result.first;
+        gameData.pagination = result.second;
+        gameData.title = "Games";
+        gameData.baseUrl = baseUrl;
+        gameData.consoleName = consoleName;
+        return gameData;
+    }, [this](const GameListData& gameData) {
+        handleGamesLoaded(gameData);
+    });
+}
+
+// Same fetch as a page change, but the result is parked on the list screen until the user scrolls there
+void MenuApplication::prefetchGamesAsync(std::weak_ptr<ListScreen> screen, const std::string& baseUrl, int page,
+                                         const TaskPool::CancelToken& task) {
+    auto scraper = currentScraper();
+    if (!scraper) return;
+    TaskPool::run(TaskPool::Priority::Background, task, [scraper, baseUrl, page]() {
+        return scraper->fetchGames(baseUrl, page);
+    }, [screen, baseUrl, page](const std::pair<std::vector<ListItem>, PaginationInfo>& result) {
+        if (auto listScreen = screen.lock()) listScreen->setPrefetchedPage(baseUrl, page, result.first, result.second);
+    });
+}
+
+void MenuApplication::runListQueryAsync(std::weak_ptr<ListScreen> screen, int ticket, ListScreen::ListQuery query,
+                                        const TaskPool::CancelToken& task) {
+    TaskPool::run(TaskPool::Priority::Normal, task, [query]() {
+        return query();
+    }, [screen, ticket](const std::pair<std::vector<ListItem>, PaginationInfo>& result) {
+        if (auto listScreen = screen.lock()) listScreen->setQueryResult(ticket, result.first, result.second);
+    });
 }
 
-void MenuApplication::fetchGameDetailsAsync(const ListItem& game, SDL_Texture* iconTexture, const std::string& consoleName) {
+void MenuApplication::fetchGameDetailsAsync(const ListItem& game, SDL_Texture* iconTexture, SDL_Rect iconRect, const std::string& consoleName,
+                                            const TaskPool::CancelToken& token) {
     std::cout << "[MenuApplication] fetchGameDetailsAsync called for game: " << game.label << std::endl;
     std::cout << "[MenuApplication] downloadUrl: " << game.downloadUrl << std::endl;
     std::cout << "[MenuApplication] consoleName: " << consoleName << std::endl;
-    std::thread([this, game, iconTexture, consoleName]() {
-        auto scraper = currentScraper();
-        std::cout << "[MenuApplication] Current scraper available: " << (scraper != nullptr) << std::endl;
+    auto scraper = currentScraper();
+    std::cout << "[MenuApplication] Current scraper available: " << (scraper != nullptr) << std::endl;
+    TaskPool::run(TaskPool::Priority::Interactive, token, [scraper, game, iconTexture, iconRect, consoleName]() {
         GameDetails details = scraper ? scraper->fetchGameDetails(game.downloadUrl) : GameDetails{};
         details.consoleName = consoleName;
         details.mappedFolder = getFolderForScrapedConsole(consoleName);
-        SDL_Event event; SDL_zero(event);
-        event.type = SDL_USEREVENT; event.user.code = EVENT_GAME_DETAILS_LOADED; event.user.data1 = new DetailsWithTexture{details, iconTexture};
-        SDL_PushEvent(&event);
-    }).detach();
+        return DetailsWithTexture{details, iconTexture, iconRect};
+    }, [this](const DetailsWithTexture& detailsWithTex) {
+        handleGameDetailsLoaded(detailsWithTex);
+    });
 }
 
 void MenuApplication::fetchPatchNotesAsync(std::shared_ptr<PatchNotesScreen> patchScreen) {
-    std::thread([patchScreen]() {
+    std::weak_ptr<PatchNotesScreen> screen = patchScreen;
+    TaskPool::run(TaskPool::Priority::Background, TaskPool::CancelToken(), []() {
         std::string notes = ScrapeLatestGitHubReleaseNotes("https://github.com/StefanAngelovski/Plunder/releases/");
         std::vector<std::string> lines; size_t pos = 0, prev = 0;
         while ((pos = notes.find('\n', prev)) != std::string::npos) { lines.push_back(notes.substr(prev, pos - prev)); prev = pos + 1; }
         if (prev < notes.size()) lines.push_back(notes.substr(prev));
-        SDL_Event event; SDL_zero(event);
-        event.type = SDL_USEREVENT; event.user.code = EVENT_PATCH_NOTES_LOADED; event.user.data1 = new std::vector<std::string>(lines);
-        SDL_PushEvent(&event);
-    }).detach();
+        return lines;
+    }, [screen](const std::vector<std::string>& lines) {
+        if (auto patchScreen = screen.lock()) patchScreen->setNotes(lines);
+    });
 }
 
 // ===================== Misc Helpers ===================== //
@@ -266,6 +317,21 @@ void MenuApplication::showNoInternetAndExit() {
 }
 
 void MenuApplication::cleanup() {
+    TaskPool::shutdown();
+    ImageFetch::shutdown();
+    Profiler::shutdown();
+    ImageFetch::Stats fetch = ImageFetch::stats();
+    printf("[ImageFetch] requested=%lu completed=%lu failed=%lu dropped=%lu\n",
+           fetch.requested, fetch.completed, fetch.failed, fetch.dropped);
+    HttpClient::PoolStats pool = HttpClient::poolStats();
+    printf("[HttpClient] connections opened=%ld reused=%ld tls full=%ld resumed=%ld idle evicted=%ld\n",
+           pool.connectionsOpened, pool.connectionsReused, pool.tlsFull, pool.tlsResumed, pool.idleEvicted);
+    HttpClient::closeIdleConnections();
+    TextCache::Stats text = TextCache::stats();
+    printf("[TextCache] runs hit=%lu rendered=%lu evicted=%lu, layouts hit=%lu computed=%lu\n",
+           text.runHits, text.runMisses, text.runEvictions, text.layoutHits, text.layoutMisses);
+    TextCache::clear();
+    Sprites::clear();
     if (font) TTF_CloseFont(font);
     if (renderer) SDL_DestroyRenderer(renderer);
     if (window) SDL_DestroyWindow(window);
@@ -286,22 +352,22 @@ void MenuApplication::initController() {
     }
 }
 
+void MenuApplication::openSite(size_t siteIdx) {
+    if (siteIdx >= siteRegistry.size()) return;
+    currentSiteIndex = (int)siteIdx;
+    currentSite = siteRegistry[siteIdx].id;
+    showNoInternetAndExit();
+    if (!running) return; // user chose to exit
+    fetchConsolesAsync(showLoadingScreen("Loading consoles from " + siteRegistry[siteIdx].id));
+}
+
 void MenuApplication::setupScreens() {
     auto carousel = std::make_shared<CarouselMenuScreen>("Main Menu");
-    auto loadRomSite = [this](size_t siteIdx) {
-        if (siteIdx >= siteRegistry.size()) return;
-        currentSiteIndex = (int)siteIdx;
-        currentSite = siteRegistry[siteIdx].id;
-        showNoInternetAndExit();
-        if (!running) return; // user chose to exit
-    menuSystem->pushScreen(std::make_shared<LoadingScreen>("Loading consoles from " + siteRegistry[siteIdx].id));
-        fetchConsolesAsync();
-    };
-    carousel->addItem("Rom Sites", "", [this, loadRomSite]() {
+    carousel->addItem("Rom Sites", "", [this]() {
         auto romSites = std::make_shared<CarouselMenuScreen>("ROM Sites");
         for (size_t i = 0; i < siteRegistry.size(); ++i) {
             const auto& sd = siteRegistry[i];
-            romSites->addItem(sd.id, "", [this, loadRomSite, i]() { loadRomSite(i); });
+            romSites->addItem(sd.id, "", [this, i]() { openSite(i); });
         }
         menuSystem->pushScreen(romSites);
     });
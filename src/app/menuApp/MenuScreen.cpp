@@ -8,6 +8,7 @@ void MenuScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     Uint32 now = SDL_GetTicks();
     if (lastTick == 0) lastTick = now;
     float dt = (now - lastTick) / 1000.0f;
+    if (dt > 0.05f) dt = 0.05f; // frames stop while idle; don't jump on the first one after
     lastTick = now;
 
     // Smoothly approach target index
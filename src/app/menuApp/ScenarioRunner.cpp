@@ -0,0 +1,198 @@
+#include "include/ScenarioRunner.h"
+#include "../screenListing/include/ListScreen.h"
+#include "../loadingScreen/include/LoadingScreen.h"
+#include "../../scraper/CachingScraper.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// A step that has not produced its screen and grid by then counts as timed out
+const Uint32 kStepTimeoutMs = 30000;
+
+Uint32 median(std::vector<Uint32> values) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+} // namespace
+
+std::unique_ptr<ScenarioRunner> ScenarioRunner::fromEnvironment() {
+    const char* path = getenv("PLUNDER_SCENARIO");
+    if (!path || !*path) return nullptr;
+    std::unique_ptr<ScenarioRunner> runner(new ScenarioRunner());
+    if (!runner->load(path)) return nullptr;
+    printf("[Scenario] %s: %zu steps\n", path, runner->steps.size());
+    return runner;
+}
+
+bool ScenarioRunner::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        printf("[Scenario] cannot read %s\n", path.c_str());
+        return false;
+    }
+    scriptPath = path;
+    std::string text;
+    int line = 0;
+    while (std::getline(in, text)) {
+        line++;
+        size_t hash = text.find('#');
+        if (hash != std::string::npos) text.erase(hash);
+        std::istringstream fields(text);
+        Step step;
+        step.line = line;
+        if (!(fields >> step.command)) continue;
+        std::getline(fields >> std::ws, step.arg);
+        while (!step.arg.empty() && isspace((unsigned char)step.arg.back())) step.arg.pop_back();
+        steps.push_back(step);
+    }
+    return true;
+}
+
+bool ScenarioRunner::update(MenuSystem& menuSystem, const std::function<bool(const std::string&)>& openSite) {
+    if (finished) return false;
+    if (measuring) {
+        if (!pollMeasurement(menuSystem)) return true;
+        measuring = false;
+        report(current);
+        results.push_back(current);
+        current = Measurement();
+    }
+    if (sleepUntil && (Sint32)(SDL_GetTicks() - sleepUntil) < 0) return true;
+    sleepUntil = 0;
+    if (nextStep >= steps.size()) {
+        summarize();
+        finished = true;
+        return false;
+    }
+    const Step& step = steps[nextStep++];
+    if (!runStep(step, menuSystem, openSite)) {
+        printf("[Scenario] %s:%d: '%s %s' failed, stopping\n", scriptPath.c_str(), step.line, step.command.c_str(), step.arg.c_str());
+        summarize();
+        finished = true;
+        return false;
+    }
+    return true;
+}
+
+bool ScenarioRunner::runStep(const Step& step, MenuSystem& menuSystem, const std::function<bool(const std::string&)>& openSite) {
+    if (step.command == "site") {
+        beginMeasurement("site " + step.arg, menuSystem);
+        return openSite(step.arg);
+    }
+    if (step.command == "open") {
+        auto list = std::dynamic_pointer_cast<ListScreen>(menuSystem.getCurrentScreen());
+        if (!list) return false;
+        const std::vector<ListItem>& items = list->getItems();
+        int index = -1;
+        if (!step.arg.empty() && step.arg.find_first_not_of("0123456789") == std::string::npos) {
+            index = atoi(step.arg.c_str());
+        } else {
+            for (size_t i = 0; i < items.size() && index < 0; ++i) {
+                if (items[i].label.find(step.arg) != std::string::npos) index = (int)i;
+            }
+        }
+        if (index < 0 || index >= (int)items.size()) return false;
+        beginMeasurement("open " + items[index].label, menuSystem);
+        list->activateItem(index);
+        return true;
+    }
+    if (step.command == "back") {
+        menuSystem.popScreen();
+        return true;
+    }
+    if (step.command == "sleep") {
+        sleepUntil = SDL_GetTicks() + (Uint32)std::max(0, atoi(step.arg.c_str()));
+        if (sleepUntil == 0) sleepUntil = 1;
+        return true;
+    }
+    if (step.command == "cold") {
+        system(("rm -rf " + ListScreen::imageCacheDir() + " && mkdir -p " + ListScreen::imageCacheDir()).c_str());
+        CachingScraper::invalidateAll();
+        return true;
+    }
+    printf("[Scenario] unknown command '%s'\n", step.command.c_str());
+    return false;
+}
+
+void ScenarioRunner::beginMeasurement(const std::string& label, MenuSystem& menuSystem) {
+    current = Measurement();
+    current.label = label;
+    current.start = SDL_GetTicks();
+    current.from = menuSystem.getCurrentScreen();
+    measuring = true;
+}
+
+bool ScenarioRunner::pollMeasurement(MenuSystem& menuSystem) {
+    Uint32 now = SDL_GetTicks();
+    std::shared_ptr<Screen> screen = menuSystem.getCurrentScreen();
+    if (!current.shown) {
+        bool arrived = screen && screen != current.from && !std::dynamic_pointer_cast<LoadingScreen>(screen);
+        if (arrived) {
+            current.shown = now;
+            current.target = screen;
+            current.isList = std::dynamic_pointer_cast<ListScreen>(screen) != nullptr;
+            if (!current.isList) return true;
+        }
+    }
+    if (current.shown) {
+        // Navigated away (or the list was replaced) before the grid filled: stop here
+        auto list = std::dynamic_pointer_cast<ListScreen>(screen);
+        if (screen != current.target || !list) return true;
+        ListScreen::TileProgress progress = list->tileProgress();
+        current.tiles = progress.total;
+        current.failedTiles = progress.failed;
+        if (progress.loaded > 0 && !current.firstTile) current.firstTile = now;
+        if (progress.loaded + progress.failed >= progress.total) {
+            current.grid = now;
+            return true;
+        }
+    }
+    if (now - current.start >= kStepTimeoutMs) {
+        current.timedOut = true;
+        return true;
+    }
+    return false;
+}
+
+void ScenarioRunner::report(const Measurement& m) const {
+    char line[256];
+    int n = snprintf(line, sizeof(line), "[Scenario] %-32.48s", m.label.c_str());
+    auto elapsed = [&m](Uint32 t) { return t ? (long)(t - m.start) : -1L; };
+    if (!m.shown) {
+        printf("%s no screen after %u ms\n", line, kStepTimeoutMs);
+        return;
+    }
+    n += snprintf(line + n, sizeof(line) - n, " screen %5ld ms", elapsed(m.shown));
+    if (m.isList) {
+        if (m.tiles == 0) {
+            snprintf(line + n, sizeof(line) - n, "  (no images)");
+        } else {
+            n += snprintf(line + n, sizeof(line) - n, "  first tile %5ld ms", elapsed(m.firstTile));
+            if (m.grid) n += snprintf(line + n, sizeof(line) - n, "  grid %5ld ms", elapsed(m.grid));
+            else n += snprintf(line + n, sizeof(line) - n, "  grid %s", m.timedOut ? "timed out" : "abandoned");
+            snprintf(line + n, sizeof(line) - n, "  (%d tiles, %d failed)", m.tiles, m.failedTiles);
+        }
+    }
+    printf("%s\n", line);
+}
+
+void ScenarioRunner::summarize() const {
+    std::vector<Uint32> screen, firstTile, grid;
+    int timedOut = 0;
+    for (const Measurement& m : results) {
+        if (m.timedOut) timedOut++;
+        if (m.shown) screen.push_back(m.shown - m.start);
+        if (m.firstTile) firstTile.push_back(m.firstTile - m.start);
+        if (m.grid && m.tiles > 0) grid.push_back(m.grid - m.start);
+    }
+    printf("[Scenario] finished %zu/%zu steps, %zu timed, %d timed out\n", nextStep, steps.size(), results.size(), timedOut);
+    printf("[Scenario] median ms: screen %u, first tile %u, full grid %u\n", median(screen), median(firstTile), median(grid));
+}
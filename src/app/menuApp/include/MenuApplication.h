@@ -3,6 +3,7 @@
 #include "MenuSystem.h"
 #include "../../Screen.h"
 #include "MenuScreen.h"
+#include "ScenarioRunner.h"
 #include "../../carousel/include/CarouselMenuScreen.h"
 #include "../../screenListing/include/ListScreen.h"
 #include "../../loadingScreen/include/LoadingScreen.h"
@@ -12,7 +13,14 @@
 #include "../../consolePolicies/GameListData.h"
 #include "../../../utils/include/UiUtils.h"
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/ImageFetch.h"
+#include "../../../utils/include/TextCache.h"
+#include "../../../utils/include/Sprites.h"
+#include "../../../utils/include/Patterns.h"
+#include "../../../utils/include/Profiler.h"
+#include "../../../utils/include/TaskPool.h"
 #include "../../../scraper/SiteScraper.h"
+#include "../../../scraper/CachingScraper.h"
 #include "../../../scraper/Hexrom/include/HexromScraper.h"
 #include "../../../scraper/Gamulator/include/GamulatorScraper.h"
 #include "../../../scraper/GithubReleases/include/GitHubReleasesScraper.h"
@@ -51,6 +59,7 @@ private:
     int currentSiteIndex = -1; // index into siteRegistry
     std::string currentSite;   // cached convenience (display or id)
     std::string currentConsoleName; // track current console for persistence
+    std::unique_ptr<ScenarioRunner> scenario; // set when PLUNDER_SCENARIO names a script
 public:
     MenuApplication();
     ~MenuApplication();
@@ -61,17 +70,24 @@ private:
     void initController();
     void setupScreens();
     void buildSiteRegistry();
+    void openSite(size_t siteIdx);
     std::shared_ptr<SiteScraper> currentScraper() const;
     int findSiteIndexById(const std::string& id) const;
     void processEvent(const SDL_Event& e);
-    void handleConsolesLoaded(std::vector<ListItem>* consolesPtr);
-    void handleGamesLoaded(GameListData* gameData);
-    void handleGameDetailsLoaded(struct DetailsWithTexture* detailsWithTex);
-    void handlePatchNotesLoaded(std::vector<std::string>* linesPtr);
+    void handleConsolesLoaded(const std::vector<ListItem>& consoles);
+    void handleGamesLoaded(const GameListData& gameData);
+    void handleGameDetailsLoaded(const struct DetailsWithTexture& detailsWithTex);
     void updateCurrentScreenAnimations(bool& needsRedraw);
-    void fetchConsolesAsync();
-    void fetchGamesAsync(const std::string& baseUrl, int page, bool showLoadingScreen);
-    void fetchGameDetailsAsync(const ListItem& game, SDL_Texture* iconTexture, const std::string& consoleName);
+    // Push a LoadingScreen whose B button cancels the returned token's task
+    TaskPool::CancelToken showLoadingScreen(const std::string& message);
+    void fetchConsolesAsync(const TaskPool::CancelToken& token);
+    void fetchGamesAsync(const std::string& baseUrl, int page, const TaskPool::CancelToken& token = TaskPool::CancelToken());
+    void prefetchGamesAsync(std::weak_ptr<ListScreen> screen, const std::string& baseUrl, int page,
+                            const TaskPool::CancelToken& task);
+    void runListQueryAsync(std::weak_ptr<ListScreen> screen, int ticket, ListScreen::ListQuery query,
+                           const TaskPool::CancelToken& task);
+    void fetchGameDetailsAsync(const ListItem& game, SDL_Texture* iconTexture, SDL_Rect iconRect, const std::string& consoleName,
+                               const TaskPool::CancelToken& token);
     static void fetchPatchNotesAsync(std::shared_ptr<PatchNotesScreen> patchScreen);
     void showNoInternetAndExit();
 };
\ No newline at end of file
@@ -30,4 +30,5 @@ public:
     void clearItems();
     void render(SDL_Renderer* renderer, TTF_Font* font) override;
     void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
+    bool isAnimating() override { return animSelectedIndex != (float)selectedIndex; }
 };
\ No newline at end of file
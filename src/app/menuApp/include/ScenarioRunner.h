@@ -0,0 +1,73 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// SDL
+#include <SDL2/SDL.h>
+
+// Other imports
+#include "MenuSystem.h"
+#include "../../Screen.h"
+
+// Scripted end-to-end runs for latency testing, usually against bench/mock_site_server
+// (PLUNDER_BASE_URL). PLUNDER_SCENARIO=<file> names the script: one step per line, '#' starts
+// a comment.
+//
+//   site <id>        open a ROM site from the registry (Hexrom, Gamulator, Romspedia)
+//   open <n|text>    activate item n, or the first item whose label contains text, on the current list
+//   back             pop the current screen
+//   sleep <ms>       do nothing for a while
+//   cold             drop cached tile images and memoized scraper results
+//
+// site and open wait for the screen they lead to and, when it is a list, for its first
+// screenful of tile images, then print time to screen, time to first tile and time to a fully
+// populated grid. The app quits after the last step, printing a summary.
+class ScenarioRunner {
+public:
+    // nullptr unless PLUNDER_SCENARIO names a readable script
+    static std::unique_ptr<ScenarioRunner> fromEnvironment();
+
+    // Advance the script (main loop, every iteration). openSite returns false for an unknown
+    // site id. Returns false once the scenario has finished or failed.
+    bool update(MenuSystem& menuSystem, const std::function<bool(const std::string&)>& openSite);
+
+private:
+    struct Step {
+        int line;
+        std::string command;
+        std::string arg;
+    };
+
+    // One navigation step being timed; times are SDL ticks, 0 = not reached yet
+    struct Measurement {
+        std::string label;
+        Uint32 start = 0;
+        std::shared_ptr<Screen> from;    // screen the step started on
+        std::shared_ptr<Screen> target;  // screen it led to
+        Uint32 shown = 0;
+        Uint32 firstTile = 0;
+        Uint32 grid = 0;
+        bool isList = false;
+        bool timedOut = false;
+        int tiles = 0;
+        int failedTiles = 0;
+    };
+
+    bool load(const std::string& path);
+    bool runStep(const Step& step, MenuSystem& menuSystem, const std::function<bool(const std::string&)>& openSite);
+    void beginMeasurement(const std::string& label, MenuSystem& menuSystem);
+    bool pollMeasurement(MenuSystem& menuSystem);   // true once the step is done or timed out
+    void report(const Measurement& m) const;
+    void summarize() const;
+
+    std::string scriptPath;
+    std::vector<Step> steps;
+    size_t nextStep = 0;
+    bool measuring = false;
+    Measurement current;
+    std::vector<Measurement> results;
+    Uint32 sleepUntil = 0;
+    bool finished = false;
+};
@@ -35,4 +35,5 @@ public:
     void render(SDL_Renderer* renderer, TTF_Font* font) override;
     void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
     void update();
+    bool isAnimating() override { return axisHeldStart != 0; } // stick held: keep repeating
 };
@@ -26,23 +26,26 @@ std::string getFileExtension(const std::string& url) {
     return ".jpg";
 }
 
+// Local cache file for a remote image URL.
+std::string imageCachePath(const std::string& url) {
+    return ListScreen::imageCacheDir() + std::to_string(std::hash<std::string>{}(url)) + getFileExtension(url);
+}
+
 inline bool isGamulator(const std::string& romSite) { return romSite == "Gamulator"; }
 
-// Draw a very rough rounded rectangle (approximation by plotting corner points).
+// The filter functions take a modal but only read its constant option tables (if anything), so
+// queries running on fetch threads use these instead of the screen's modals, which may be gone
+const HexromFilterModal& hexromOptions() { static const HexromFilterModal modal; return modal; }
+const GamulatorFilterModal& gamulatorOptions() { static const GamulatorFilterModal modal; return modal; }
+const RomspediaFilterModal& romspediaOptions() { static const RomspediaFilterModal modal; return modal; }
+
+// Draw a very rough rounded rectangle (fill plus cached quarter-disc corner sprites).
 void drawApproxRoundedBorder(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color fill, Uint8 alpha) {
+    SDL_Color color = {fill.r, fill.g, fill.b, (Uint8)(fill.a * (alpha / 255.0f))};
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, fill.r, fill.g, fill.b, (Uint8)(fill.a * (alpha / 255.0f)));
+    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
     SDL_RenderFillRect(renderer, &rect);
-    for (int dx = 0; dx < radius; ++dx) {
-        for (int dy = 0; dy < radius; ++dy) {
-            if ((dx*dx + dy*dy) < radius*radius) {
-                SDL_RenderDrawPoint(renderer, rect.x + dx, rect.y + dy);
-                SDL_RenderDrawPoint(renderer, rect.x + rect.w - 1 - dx, rect.y + dy);
-                SDL_RenderDrawPoint(renderer, rect.x + dx, rect.y + rect.h - 1 - dy);
-                SDL_RenderDrawPoint(renderer, rect.x + rect.w - 1 - dx, rect.y + rect.h - 1 - dy);
-            }
-        }
-    }
+    Sprites::drawCornerDiscs(renderer, rect, radius, color);
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
 
@@ -65,24 +68,31 @@ ListScreen::ListScreen(const std::string& title, const std::string& romSite, con
     if (siteType == SiteType::Gamulator) setupGamulatorModal();
     else if (siteType == SiteType::Romspedia) setupRomspediaModal();
     else setupHexromModal();
-    textures.resize(items.size(), nullptr);
-    system("mkdir -p cache/images");
+    system(("mkdir -p " + imageCacheDir()).c_str());
+    fetchOwner = ImageFetch::registerOwner();
     queueInitialDownloads();
-    startImageLoaderThreads(renderer);
     moveSound = Mix_LoadWAV("sounds/move.wav");
     if (moveSound) Mix_VolumeChunk(moveSound, MIX_MAX_VOLUME);
     Mix_Volume(-1, MIX_MAX_VOLUME);
 }
 
 ListScreen::~ListScreen() {
+    tasks.cancel();
     if (moveSound) {
         Mix_FreeChunk(moveSound);
         moveSound = nullptr;
     }
-    stopThreads = true;
-    stopImageLoaderThreads();
-    for (auto texture : textures) if (texture) SDL_DestroyTexture(texture);
-    // unique_ptr modals auto-clean
+    ImageFetch::unregisterOwner(fetchOwner);
+    const TileTextureCache::Stats& tex = textureCache.stats();
+    printf("[TextureCache] %s: hits=%lu misses=%lu evictions=%lu reloads=%lu peak=%zuKB budget=%zuKB atlas pages=%d\n",
+           title.c_str(), tex.hits, tex.misses, tex.evictions, tex.reloads, tex.peakBytes / 1024, textureCache.budget() / 1024,
+           textureCache.atlasPages());
+    // One RenderCopy per image before batching, so quads/frame is the old draw call count
+    if (drawStats.frames > 0) {
+        printf("[TextureCache] %s: per frame %.1f image quads in %.1f draw calls\n", title.c_str(),
+               (double)drawStats.imageQuads / drawStats.frames, (double)drawStats.imageDrawCalls / drawStats.frames);
+    }
+    // textureCache and unique_ptr modals auto-clean
 }
 
 // --- Site-specific modal setup helpers -----------------------------------------------------
@@ -127,8 +137,7 @@ void ListScreen::applyNewResult(const std::vector<ListItem>& newItems, const Pag
         pagination = newPagination;
         selectedIndex = 0;
         scrollOffset = 0;
-        textures.clear();
-        textures.resize(items.size(), nullptr);
+        resetTextures();
     } else {
         // When appending (pagination), check if we got empty results
         if (newItems.empty() && newPagination.currentPage > 1) {
@@ -141,6 +150,7 @@ void ListScreen::applyNewResult(const std::vector<ListItem>& newItems, const Pag
 }
 
 void ListScreen::runSiteFilter(const std::string& search, int region, int sort, int order, int genre) {
+    siteQueryActive = true;
     if (siteType == SiteType::Gamulator) {
         gamulatorSearch = search;
         // Always use filter for Gamulator if we're in a specific console (baseUrl contains /roms/console-name)
@@ -172,13 +182,15 @@ void ListScreen::runSiteFilter(const std::string& search, int region, int sort,
             
             // Use the original console URL for filtering, not the current pagination.baseUrl
             std::string filterBaseUrl = gamulatorOriginalConsoleUrl.empty() ? pagination.baseUrl : gamulatorOriginalConsoleUrl;
-            auto result = GamulatorScraperFilter::filterGames(searchUrl, filterBaseUrl, gamulatorSearch, 1);
-            applyNewResult(result.first, result.second, true);
+            startQuery([searchUrl, filterBaseUrl, search] {
+                return GamulatorScraperFilter::filterGames(searchUrl, filterBaseUrl, search, 1);
+            }, true, "Searching...");
         } else {
             // Use the original filter function for non-console specific searches
             std::string filterBaseUrl = gamulatorOriginalConsoleUrl.empty() ? pagination.baseUrl : gamulatorOriginalConsoleUrl;
-            auto result = GamulatorScraperFilter::filterGames(filterBaseUrl, *gamulatorModal, gamulatorSearch, 1);
-            applyNewResult(result.first, result.second, true);
+            startQuery([filterBaseUrl, search] {
+                return GamulatorScraperFilter::filterGames(filterBaseUrl, gamulatorOptions(), search, 1);
+            }, true, "Searching...");
         }
         gamulatorModal->showModal(false);
     } else if (siteType == SiteType::Romspedia) {
@@ -212,22 +224,30 @@ void ListScreen::runSiteFilter(const std::string& search, int region, int sort,
             
             // Use the original console URL for filtering, not the current pagination.baseUrl
             std::string filterBaseUrl = romspediaOriginalConsoleUrl.empty() ? pagination.baseUrl : romspediaOriginalConsoleUrl;
-            auto result = RomspediaScraperFilter::filterGames(searchUrl, filterBaseUrl, romspediaSearch, 1);
-            applyNewResult(result.first, result.second, true);
+            startQuery([searchUrl, filterBaseUrl, search] {
+                return RomspediaScraperFilter::filterGames(searchUrl, filterBaseUrl, search, 1);
+            }, true, "Searching...");
         } else {
             // Use the original filter function for non-console specific searches
-            auto result = RomspediaScraperFilter::filterGames(pagination.baseUrl, *romspediaModal, romspediaSearch);
-            applyNewResult(result.first, result.second, true);
+            std::string baseUrl = pagination.baseUrl;
+            startQuery([baseUrl, search] {
+                return RomspediaScraperFilter::filterGames(baseUrl, romspediaOptions(), search);
+            }, true, "Searching...");
         }
         romspediaModal->showModal(false);
     } else {
-        auto result = HexromScraperFilter::filterGames(pagination.baseUrl, *hexromModal, search, region, sort, order, genre);
-        applyNewResult(result.first, result.second, true);
+        std::string baseUrl = pagination.baseUrl;
+        startQuery([baseUrl, search, region, sort, order, genre] {
+            return HexromScraperFilter::filterGames(baseUrl, hexromOptions(), search, region, sort, order, genre);
+        }, true, "Searching...");
         hexromModal->showModal(false);
     }
 }
 
+// Next (or first) page of the current filter results
 void ListScreen::runSitePaginate(int page) {
+    std::string baseUrl = pagination.baseUrl;
+    std::string label = "Loading page " + std::to_string(page) + "...";
     if (siteType == SiteType::Gamulator) {
         if (gamulatorFilterActive) {
             // Check if we're filtering within a specific console
@@ -235,20 +255,26 @@ void ListScreen::runSitePaginate(int page) {
                                    gamulatorOriginalConsoleUrl.find("/roms/") != std::string::npos && 
                                    gamulatorOriginalConsoleUrl.find("gamulator.com/roms") != std::string::npos &&
                                    gamulatorOriginalConsoleUrl != "https://www.gamulator.com/roms";
+            std::string consoleUrl = gamulatorOriginalConsoleUrl;
+            std::string search = gamulatorSearch;
             
             if (isConsoleSpecific && !gamulatorSearch.empty()) {
                 // Use console-specific filtering with the original console URL
-                auto result = GamulatorScraperFilter::filterGames(pagination.baseUrl, gamulatorOriginalConsoleUrl, gamulatorSearch, page);
-                applyNewResult(result.first, result.second, page == 1);
+                startQuery([baseUrl, consoleUrl, search, page] {
+                    return GamulatorScraperFilter::filterGames(baseUrl, consoleUrl, search, page);
+                }, page == 1, label);
             } else {
                 // Use regular search filtering
-                std::string filterBaseUrl = gamulatorOriginalConsoleUrl.empty() ? pagination.baseUrl : gamulatorOriginalConsoleUrl;
-                auto result = GamulatorScraperFilter::filterGames(filterBaseUrl, *gamulatorModal, gamulatorSearch, page);
-                applyNewResult(result.first, result.second, page == 1);
+                std::string filterBaseUrl = consoleUrl.empty() ? baseUrl : consoleUrl;
+                startQuery([filterBaseUrl, search, page] {
+                    return GamulatorScraperFilter::filterGames(filterBaseUrl, gamulatorOptions(), search, page);
+                }, page == 1, label);
             }
         } else {
-            GamulatorScraper s; auto result = s.fetchGames(pagination.baseUrl, page);
-            applyNewResult(result.first, result.second, page == 1);
+            std::shared_ptr<SiteScraper> scraper = pageScraper();
+            startQuery([scraper, baseUrl, page] {
+                return scraper->fetchGames(baseUrl, page);
+            }, page == 1, label);
         }
     } else if (siteType == SiteType::Romspedia) {
         // Check if we have a search URL in pagination.baseUrl (this means we're in search mode)
@@ -259,146 +285,143 @@ void ListScreen::runSitePaginate(int page) {
                                    romspediaOriginalConsoleUrl.find("/roms/") != std::string::npos && 
                                    romspediaOriginalConsoleUrl.find("romspedia.com/roms") != std::string::npos &&
                                    romspediaOriginalConsoleUrl != "https://www.romspedia.com/roms";
+            std::string consoleUrl = romspediaOriginalConsoleUrl;
+            std::string search = romspediaSearch;
             
             if (isConsoleSpecific && !romspediaSearch.empty()) {
                 // Use console-specific filtering with the original console URL
-                auto result = RomspediaScraperFilter::filterGames(pagination.baseUrl, romspediaOriginalConsoleUrl, romspediaSearch, page);
-                applyNewResult(result.first, result.second, page == 1);
+                startQuery([baseUrl, consoleUrl, search, page] {
+                    return RomspediaScraperFilter::filterGames(baseUrl, consoleUrl, search, page);
+                }, page == 1, label);
             } else {
                 // Use regular search filtering
-                auto result = RomspediaScraperFilter::filterGames(pagination.baseUrl, *romspediaModal, romspediaSearch, page);
-                applyNewResult(result.first, result.second, page == 1);
+                startQuery([baseUrl, search, page] {
+                    return RomspediaScraperFilter::filterGames(baseUrl, romspediaOptions(), search, page);
+                }, page == 1, label);
             }
         } else {
-            RomspediaScraper s; auto result = s.fetchGames(pagination.baseUrl, page);
-            applyNewResult(result.first, result.second, page == 1);
+            std::shared_ptr<SiteScraper> scraper = pageScraper();
+            startQuery([scraper, baseUrl, page] {
+                return scraper->fetchGames(baseUrl, page);
+            }, page == 1, label);
         }
     } else { // Hexrom standard pagination (no custom backward implemented yet)
-        HexromScraper s; auto result = s.fetchGames(pagination.baseUrl, page);
-        applyNewResult(result.first, result.second, page == 1);
+        std::shared_ptr<SiteScraper> scraper = pageScraper();
+        startQuery([scraper, baseUrl, page] {
+            return scraper->fetchGames(baseUrl, page);
+        }, page == 1, label);
+    }
+}
+
+// The previous result stays on screen (and navigable) until the new one is applied in one go
+void ListScreen::startQuery(ListQuery fetch, bool replace, const std::string& label) {
+    int ticket = ++query.ticket;
+    if (replace) dropPrefetch(); // the list it belongs to is about to be replaced
+    query.busy = true;
+    query.replace = replace;
+    query.label = label;
+    loadingMore = !replace;
+    query.task.cancel();
+    query.task = tasks.child();
+    if (onRunQuery) {
+        onRunQuery(ticket, std::move(fetch), query.task);
+        return;
     }
+    auto result = fetch();
+    setQueryResult(ticket, result.first, result.second);
+}
+
+std::shared_ptr<SiteScraper> ListScreen::pageScraper() const {
+    if (scraper) return scraper;
+    if (siteType == SiteType::Gamulator) return std::make_shared<CachingScraper>(std::make_shared<GamulatorScraper>());
+    if (siteType == SiteType::Romspedia) return std::make_shared<CachingScraper>(std::make_shared<RomspediaScraper>());
+    return std::make_shared<CachingScraper>(std::make_shared<HexromScraper>());
+}
+
+void ListScreen::setQueryResult(int ticket, const std::vector<ListItem>& newItems, const PaginationInfo& newPagination) {
+    if (!query.busy || ticket != query.ticket) return; // superseded by a newer query
+    query.busy = false;
     loadingMore = false;
+    applyNewResult(newItems, newPagination, query.replace);
 }
 
 // Queue up images for visible and just-offscreen items (preload extra rows).
 void ListScreen::queueInitialDownloads() {
     int preloadRows = VISIBLE_ROWS + 2; // Preload 2 extra rows
+    ImageFetch::setViewport(fetchOwner, 0, preloadRows * GRID_COLUMNS - 1, 1);
     for (int row = 0; row < preloadRows; row++) {
         for (int col = 0; col < GRID_COLUMNS; col++) {
-            int index = getIndexFromGrid(row, col, GRID_COLUMNS);
-            if (index >= 0 && index < items.size() && !items[index].imagePath.empty() && items[index].imagePath.find("http") == 0) {
-                std::lock_guard<std::mutex> lock(downloadMutex);
-                pendingDownloads[index] = items[index].imagePath;
-            }
+            requestImage(getIndexFromGrid(row, col, GRID_COLUMNS));
         }
     }
 }
 
-// Spawn a small pool of threads to download images in the background.
-void ListScreen::startImageLoaderThreads(SDL_Renderer* renderer) {
-    int numThreads = 8; // Tuned for faster icon loading
-    for (int i = 0; i < numThreads; ++i) {
-        loaderThreads.emplace_back([this]() {
-            while (!stopThreads) {
-                int idx = -1;
-                std::string url;
-                {
-                    std::lock_guard<std::mutex> lock(downloadMutex);
-                    if (!pendingDownloads.empty()) {
-                        auto it = pendingDownloads.begin();
-                        idx = it->first;
-                        url = it->second;
-                        pendingDownloads.erase(it);
-                    }
-                }
-                if (idx >= 0 && !url.empty()) {
-                    std::string ext = getFileExtension(url);
-                    std::string filename = "cache/images/" + std::to_string(std::hash<std::string>{}(url)) + ext;
-                    if (HttpUtils::downloadImage(url, filename)) {
-                        std::lock_guard<std::mutex> lock(downloadMutex);
-                        readyImages.push({idx, filename});
-                    }
-                } else {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                }
-            }
-        });
-    }
+// Hand a remote image to the fetch scheduler (it ignores indices already queued or failed).
+void ListScreen::requestImage(int index) {
+    if (index < 0 || index >= items.size() || textureCache.contains(index)) return;
+    const std::string& url = items[index].imagePath;
+    if (url.empty() || url.find("http") != 0) return;
+    ImageFetch::request(fetchOwner, index, url, imageCachePath(url), TILE_IMAGE_W, TILE_IMAGE_H);
 }
 
-void ListScreen::stopImageLoaderThreads() {
-    for (auto& t : loaderThreads) {
-        if (t.joinable()) t.join();
-    }
-    loaderThreads.clear();
+void ListScreen::resetTextures() {
+    ImageFetch::cancel(fetchOwner);
+    textureCache.clear();
+    failedImages.clear();
 }
 
-// Consume finished downloads and convert them to SDL_Textures.
+// Upload surfaces the workers have already decoded and scaled. Decoding never happens here;
+// uploads stop for this frame once the byte or time budget is spent.
 void ListScreen::updateTextures(SDL_Renderer* renderer) {
-    std::lock_guard<std::mutex> lock(downloadMutex);
-    while (!readyImages.empty()) {
-        auto tmp = readyImages.front();
-        int idx = tmp.first;
-        std::string path = tmp.second;
-        readyImages.pop();
-        if (idx >= 0 && idx < items.size() && idx < textures.size() && !textures[idx]) {
-            SDL_Surface* surface = nullptr;
-            if (path.size() > 5 && path.substr(path.size() - 5) == ".webp") {
-                SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "rb");
-                if (rw) {
-                    surface = IMG_LoadWEBP_RW(rw);
-                    SDL_RWclose(rw);
-                }
-            } else {
-                surface = IMG_Load(path.c_str());
-            }
-            if (surface) {
-                textures[idx] = SDL_CreateTextureFromSurface(renderer, surface);
-                SDL_FreeSurface(surface);
-            } else {
-                // Suppressed verbose SDL_image shader compile errors (noise on device)
-                // std::cerr << "[Image] fail: " << path << std::endl;
-            }
+    Profiler::Scope scope("ListScreen::updateTextures");
+    Uint32 start = SDL_GetTicks();
+    size_t uploadedBytes = 0;
+    ImageFetch::Result result;
+    while (uploadedBytes < UPLOAD_BUDGET_BYTES && SDL_GetTicks() - start < UPLOAD_BUDGET_MS &&
+           ImageFetch::poll(fetchOwner, result)) {
+        int idx = result.index;
+        SDL_Surface* surface = result.surface;
+        // Drop results whose slot now holds a different item
+        bool wanted = surface && idx >= 0 && idx < items.size() && !textureCache.contains(idx) &&
+                      items[idx].imagePath == result.url;
+        if (wanted) {
+            textureCache.put(renderer, idx, surface);
+            uploadedBytes += ImageUtils::byteSize(surface);
         }
+        if (!result.ok && idx >= 0 && idx < items.size() && items[idx].imagePath == result.url) failedImages.insert(idx);
+        if (surface) SDL_FreeSurface(surface);
+    }
+    Profiler::setTextureBytes("tiles", textureCache.textureBytes());
+}
+
+ListScreen::TileProgress ListScreen::tileProgress() const {
+    TileProgress progress;
+    int first = scrollOffset * currentGridColumns;
+    int last = std::min((int)items.size(), first + currentVisibleRows * currentGridColumns) - 1;
+    for (int i = first; i <= last; ++i) {
+        if (!hasRemoteImage(i)) continue;
+        progress.total++;
+        if (textureCache.contains(i)) progress.loaded++;
+        else if (failedImages.count(i)) progress.failed++;
     }
+    return progress;
+}
+
+const std::string& ListScreen::imageCacheDir() {
+    // Mock-server images must never be shown for the real sites' urls
+    static const std::string dir = HttpClient::baseUrlOverride().empty() ? "cache/images/" : "cache/mock-images/";
+    return dir;
 }
 
 // Opportunistic single-item texture load (used when ensuring a specific index is ready).
+// Remote and local images alike are decoded by the fetch workers and uploaded in updateTextures.
 void ListScreen::loadTexture(SDL_Renderer* renderer, int index) {
-    if (index < 0 || index >= items.size() || index >= textures.size()) return;
-    if (textures[index]) return;
-    // If image is already cached locally, load instantly
-    std::string filename;
-    if (!items[index].imagePath.empty() && items[index].imagePath.find("http") == 0) {
-        std::string ext = getFileExtension(items[index].imagePath);
-        filename = "cache/images/" + std::to_string(std::hash<std::string>{}(items[index].imagePath)) + ext;
-        std::ifstream file(filename);
-        if (file.good()) {
-            file.close();
-            SDL_Surface* surface = IMG_Load(filename.c_str());
-            if (surface) {
-                textures[index] = SDL_CreateTextureFromSurface(renderer, surface);
-                SDL_FreeSurface(surface);
-            }
-            return;
-        }
-        // Not cached, queue for download
-        std::lock_guard<std::mutex> lock(downloadMutex);
-        if (pendingDownloads.find(index) == pendingDownloads.end()) {
-            pendingDownloads[index] = items[index].imagePath;
-        }
-        return;
-    }
-    // If imagePath is already a local file
-    std::ifstream fileLocal(items[index].imagePath);
-    if (fileLocal.good()) {
-        fileLocal.close();
-        SDL_Surface* surface = IMG_Load(items[index].imagePath.c_str());
-        if (surface) {
-            textures[index] = SDL_CreateTextureFromSurface(renderer, surface);
-            SDL_FreeSurface(surface);
-        }
-    }
+    (void)renderer;
+    if (index < 0 || index >= items.size() || textureCache.contains(index)) return;
+    const std::string& path = items[index].imagePath;
+    if (path.empty()) return;
+    if (path.find("http") == 0) requestImage(index);
+    else ImageFetch::request(fetchOwner, index, path, path, TILE_IMAGE_W, TILE_IMAGE_H);
 }
 
 // --- Render -------------------------------------------------------------------------------
@@ -427,10 +450,7 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     int tilePadding = 32;
     int tileVerticalSpacing = 32; // More vertical spacing
     int visibleRows = 2;
-    bool allNoImages = true;
-    for (const auto& tex : textures) {
-        if (tex) { allNoImages = false; break; }
-    }
+    bool allNoImages = textureCache.empty();
     if (allNoImages) {
         gridColumns = 3; // Use 3 columns for text-only grids
         tileWidth = 340; // Wider for more text
@@ -464,22 +484,24 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
     float scrollFrac = scrollOffsetAnim - scrollBase;
     bool isSettled = fabs(scrollOffsetAnim - scrollOffset) < 0.01f;
     int rowsToDraw = visibleRows + (isSettled ? 0 : 1);
-    // Preload/queue image loads for visible and just-offscreen items (but do NOT synchronously load in render)
+    // Preload/queue image loads for visible and just-offscreen items (but do NOT synchronously load in render).
+    // The scheduler serves the visible range first, then rows ahead of the scroll direction.
     int preloadRows = rowsToDraw + 1; // Preload one extra row for smoothness
+    int scrollDirection = scrollBase > lastViewportRow ? 1 : (scrollBase < lastViewportRow ? -1 : 0);
+    lastViewportRow = scrollBase;
+    ImageFetch::setViewport(fetchOwner, scrollBase * gridColumns, (scrollBase + rowsToDraw) * gridColumns - 1, scrollDirection);
     for (int row = 0; row < preloadRows; row++) {
         for (int col = 0; col < gridColumns; col++) {
-            int index = getIndexFromGrid(scrollBase + row, col, gridColumns);
-            if (index >= 0 && index < items.size()) {
-                // Only queue if not already loaded or queued
-                if (!textures[index] && !items[index].imagePath.empty() && items[index].imagePath.find("http") == 0) {
-                    std::lock_guard<std::mutex> lock(downloadMutex);
-                    if (pendingDownloads.find(index) == pendingDownloads.end()) {
-                        pendingDownloads[index] = items[index].imagePath;
-                    }
-                }
-            }
+            requestImage(getIndexFromGrid(scrollBase + row, col, gridColumns));
         }
     }
+    // Keep video memory under budget; the preloaded rows are never evicted
+    textureCache.trim(scrollBase * gridColumns, (scrollBase + preloadRows) * gridColumns - 1);
+    maybePrefetch(getTotalRows(gridColumns));
+    // Tiles draw in three passes so all loaded images go out as one batched draw per atlas page:
+    // card backgrounds and placeholders, then the image batch, then corner masks and labels.
+    struct ImageTile { int index; SDL_Rect tileRect; SDL_Rect dstRect; float rowAlpha; bool isSelected; };
+    std::vector<ImageTile> imageTiles;
     for (int row = 0; row < rowsToDraw; row++) {
         // --- Fade effect for partial rows ---
         float rowAlpha = 1.0f;
@@ -493,7 +515,7 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
             }
         }
         Uint8 alpha = (Uint8)(rowAlpha * 255);
-    for (int col = 0; col < gridColumns; col++) {
+        for (int col = 0; col < gridColumns; col++) {
             int index = getIndexFromGrid(scrollBase + row, col, gridColumns);
             if (index >= 0 && index < items.size()) {
                 int y = startY + row * (tileHeight + tileVerticalSpacing) - (int)((tileHeight + tileVerticalSpacing) * scrollFrac);
@@ -508,58 +530,24 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
                 SDL_SetRenderDrawColor(renderer, 32, 120, 140, (Uint8)(210 * (rowAlpha)) );
                 SDL_RenderFillRect(renderer, &tileRect);
                 // --- Rounded corners (approximate) ---
-                // Rounded corners (approx)
                 drawApproxRoundedBorder(renderer, tileRect, 24, SDL_Color{32,120,140,(Uint8)(210 * (rowAlpha))}, alpha);
                 // --- Selection border ---
                 if (isSelected) {
                     SDL_SetRenderDrawColor(renderer, 255, 220, 60, alpha);
                     SDL_RenderDrawRect(renderer, &tileRect);
                 }
-                // --- Render image or centered text ---
-                if (index < textures.size() && textures[index]) {
-                    // --- Image area: centered, cover, aspect ratio preserved, cropped if needed ---
+                // --- Queue image, or draw the centered-text placeholder ---
+                TileTextureCache::Image image;
+                bool hasImage = hasRemoteImage(index) ? textureCache.get(index, image) : textureCache.peek(index, image);
+                if (hasImage) {
+                    // --- Image area: thumbnails are already cover-fit to this box, the atlas region is drawn whole ---
                     int imageMargin = 8;
                     int helpTextMargin = 10;
                     int textHeight = 36;
-                    int availableHeight = tileRect.h - imageMargin * 2 - textHeight - helpTextMargin;
-                    int availableWidth = tileRect.w - imageMargin * 2;
-                    int boxX = tileRect.x + imageMargin;
-                    int boxY = tileRect.y + imageMargin;
-                    int boxW = availableWidth;
-                    int boxH = availableHeight;
-                    int texW = 0, texH = 0;
-                    SDL_QueryTexture(textures[index], NULL, NULL, &texW, &texH);
-                    float boxAspect = (float)boxW / boxH;
-                    float texAspect = (float)texW / texH;
-                    SDL_Rect dstRect = {boxX, boxY, boxW, boxH};
-                    SDL_Rect srcRect = {0, 0, texW, texH};
-                    if (texAspect > boxAspect) {
-                        int cropW = (int)(texH * boxAspect);
-                        srcRect.x = (texW - cropW) / 2;
-                        srcRect.w = cropW;
-                    } else {
-                        int cropH = (int)(texW / boxAspect);
-                        srcRect.y = (texH - cropH) / 2;
-                        srcRect.h = cropH;
-                    }
-                    SDL_SetTextureAlphaMod(textures[index], alpha);
-                    SDL_RenderCopy(renderer, textures[index], &srcRect, &dstRect);
-                    SDL_SetTextureAlphaMod(textures[index], 255);
-                    // Inner rounding mask (inverse) for image corners
-                    int ir = 18;
-                    for (int dx = 0; dx < ir; ++dx) for (int dy = 0; dy < ir; ++dy) if ((dx*dx + dy*dy) > ir*ir) {
-                        SDL_SetRenderDrawColor(renderer, 32, 120, 140, (Uint8)(210 * (rowAlpha)) );
-                        SDL_RenderDrawPoint(renderer, dstRect.x + dx, dstRect.y + dy);
-                        SDL_RenderDrawPoint(renderer, dstRect.x + dstRect.w-1-dx, dstRect.y + dy);
-                        SDL_RenderDrawPoint(renderer, dstRect.x + dx, dstRect.y + dstRect.h-1-dy);
-                        SDL_RenderDrawPoint(renderer, dstRect.x + dstRect.w-1-dx, dstRect.y + dstRect.h-1-dy);
-                    }
-                    int titleY = tileRect.y + tileRect.h - textHeight - 8;
-                    std::string labelText = items[index].label.empty() ? "(No Title)" : items[index].label;
-    std::string clampedLabel = UiUtils::ClampTextToLines(labelText, font, tileRect.w - 8, 2);
-                    SDL_Rect textBox = {tileRect.x, titleY, tileRect.w, textHeight};
-    UiUtils::Color textColor = isSelected ? UiUtils::Color(255, 255, 80, alpha) : UiUtils::Color(255, 255, 255, alpha);
-    UiUtils::RenderTextCenteredInBox(renderer, font, clampedLabel, textBox, textColor);
+                    SDL_Rect dstRect = {tileRect.x + imageMargin, tileRect.y + imageMargin,
+                                        tileRect.w - imageMargin * 2, tileRect.h - imageMargin * 2 - textHeight - helpTextMargin};
+                    imageBatch.add(image.texture, image.rect, dstRect, SDL_Color{255, 255, 255, alpha});
+                    imageTiles.push_back(ImageTile{index, tileRect, dstRect, rowAlpha, isSelected});
                 } else {
                     // --- Placeholder for not-yet-loaded images ---
                     SDL_SetRenderDrawColor(renderer, 60, 60, 80, alpha); // Subtle placeholder color
@@ -572,8 +560,24 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
                 }
             }
         }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     }
+    drawStats.imageQuads += imageBatch.quadCount();
+    drawStats.imageDrawCalls += imageBatch.flush(renderer);
+    drawStats.frames++;
+    for (const auto& tile : imageTiles) {
+        Uint8 alpha = (Uint8)(tile.rowAlpha * 255);
+        const SDL_Rect& dstRect = tile.dstRect;
+        // Inner rounding mask (inverse) for image corners
+        Sprites::drawCornerMask(renderer, dstRect, 18, SDL_Color{32, 120, 140, alpha});
+        int textHeight = 36;
+        int titleY = tile.tileRect.y + tile.tileRect.h - textHeight - 8;
+        std::string labelText = items[tile.index].label.empty() ? "(No Title)" : items[tile.index].label;
+        std::string clampedLabel = UiUtils::ClampTextToLines(labelText, font, tile.tileRect.w - 8, 2);
+        SDL_Rect textBox = {tile.tileRect.x, titleY, tile.tileRect.w, textHeight};
+        UiUtils::Color textColor = tile.isSelected ? UiUtils::Color(255, 255, 80, alpha) : UiUtils::Color(255, 255, 255, alpha);
+        UiUtils::RenderTextCenteredInBox(renderer, font, clampedLabel, textBox, textColor);
+    }
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     // --- Draw vertical scrollbar ---
     int totalRows = getTotalRows(gridColumns);
     if (totalRows > visibleRows) {
@@ -610,6 +614,14 @@ void ListScreen::render(SDL_Renderer* renderer, TTF_Font* font) {
         // Move 'Loading more...' to the far right, aligned with help text and page info
         UiUtils::RenderText(renderer, font, "Loading more...", 1280 - 260, 720 - 30, UiUtils::Color(220, 220, 120));
     }
+    if (query.busy && query.replace) {
+        // The old results stay underneath until the new ones arrive
+        int labelW = 0, labelH = 0;
+        if (font) TTF_SizeText(font, query.label.c_str(), &labelW, &labelH);
+        SDL_Rect pill = {centerX - labelW / 2 - 28, 360 - labelH / 2 - 14, labelW + 56, labelH + 28};
+        drawApproxRoundedBorder(renderer, pill, 18, SDL_Color{0, 0, 0, 170}, 255);
+        UiUtils::RenderTextCentered(renderer, font, query.label, centerX, 360, UiUtils::Color(255, 255, 220));
+    }
 
     // --- Filter Modal UI ---
     if (siteType == SiteType::Gamulator && gamulatorModal && gamulatorModal->isVisible()) {
@@ -636,9 +648,8 @@ void ListScreen::appendItems(const std::vector<ListItem>& newItems, const Pagina
     int prevGridColumns = currentGridColumns > 0 ? currentGridColumns : 3;
     int prevVisibleRows = currentVisibleRows > 0 ? currentVisibleRows : 2;
 
-    // Append new items and textures
+    // Append new items (their textures load on demand)
     items.insert(items.end(), newItems.begin(), newItems.end());
-    textures.resize(items.size(), nullptr);
     pagination = newPagination;
 
     // Always advance scrollOffset by one page (prevVisibleRows) after appending, so the first new row appears after the last visible row
@@ -654,6 +665,79 @@ void ListScreen::appendItems(const std::vector<ListItem>& newItems, const Pagina
     if (selectedIndex >= (int)items.size()) selectedIndex = (int)items.size() - 1;
 }
 
+// Start fetching the next page once the viewport is close to the end. A prefetch for another
+// page or base url (a filter replaced the list) is stale and dropped.
+void ListScreen::maybePrefetch(int totalRows) {
+    int next = pagination.currentPage + 1;
+    if (prefetch.state != PrefetchState::Idle && (prefetch.page != next || prefetch.baseUrl != pagination.baseUrl)) {
+        dropPrefetch();
+    }
+    if (!onPrefetchPage || prefetch.state != PrefetchState::Idle || loadingMore) return;
+    if (siteQueryActive || query.busy) return; // filter results page through runSitePaginate
+    if (pagination.totalPages <= 1 || pagination.currentPage >= pagination.totalPages) return;
+    if (totalRows - (scrollOffset + currentVisibleRows) > PREFETCH_ROWS) return;
+    prefetch.state = PrefetchState::InFlight;
+    prefetch.baseUrl = pagination.baseUrl;
+    prefetch.page = next;
+    prefetch.task = tasks.child();
+    onPrefetchPage(prefetch.baseUrl, next, prefetch.task);
+}
+
+void ListScreen::dropPrefetch() {
+    prefetch.task.cancel();
+    prefetch = Prefetch();
+}
+
+void ListScreen::setPrefetchedPage(const std::string& baseUrl, int page, const std::vector<ListItem>& newItems, const PaginationInfo& newPagination) {
+    if (prefetch.state != PrefetchState::InFlight || prefetch.page != page || prefetch.baseUrl != baseUrl) return;
+    prefetch.state = PrefetchState::Ready;
+    prefetch.items = newItems;
+    prefetch.pagination = newPagination;
+    if (prefetch.applyOnArrival) {
+        prefetch.applyOnArrival = false;
+        requestNextPage();
+        return;
+    }
+    // Warm the thumbnails of the page's first screenful, queued by the indices they will get
+    // once appended; only the files are kept, the tiles request their images as usual
+    int first = (int)items.size();
+    int count = std::min((int)newItems.size(), currentVisibleRows * currentGridColumns);
+    for (int i = 0; i < count; ++i) {
+        const std::string& url = newItems[i].imagePath;
+        if (url.compare(0, 4, "http") != 0) continue;
+        ImageFetch::warm(fetchOwner, first + i, url, imageCachePath(url), TILE_IMAGE_W, TILE_IMAGE_H);
+    }
+}
+
+// An empty prefetch (fetch failed) is not trusted to mean "no more pages": the page is then
+// fetched the normal way, once.
+void ListScreen::requestNextPage() {
+    int next = pagination.currentPage + 1;
+    if (query.busy) return;
+    if (siteQueryActive) {
+        runSitePaginate(next);
+        return;
+    }
+    bool matches = prefetch.page == next && prefetch.baseUrl == pagination.baseUrl;
+    if (matches && prefetch.state == PrefetchState::Ready && !prefetch.items.empty()) {
+        applyPrefetched();
+        return;
+    }
+    loadingMore = true;
+    if (matches && prefetch.state == PrefetchState::InFlight) {
+        prefetch.applyOnArrival = true;
+        return;
+    }
+    if (onPageChange) onPageChange(next);
+}
+
+void ListScreen::applyPrefetched() {
+    Prefetch page = std::move(prefetch);
+    prefetch = Prefetch();
+    loadingMore = false;
+    applyNewResult(page.items, page.pagination, false);
+}
+
 // --- Fast analog stick scroll state ---
 static Uint32 axisHeldStart = 0;
 static Uint32 lastAxisTime = 0;
@@ -691,10 +775,7 @@ void ListScreen::updateAnalogScroll() {
                             scrollOffset++;
                         }
                     } else if (pagination.totalPages > 1 && pagination.currentPage < pagination.totalPages && onPageChange) {
-                        if (!loadingMore) {
-                            loadingMore = true;
-                            onPageChange(pagination.currentPage + 1);
-                        }
+                        if (!loadingMore) requestNextPage();
                     }
                 } else if (value < 0) {
                     // Scroll up
@@ -715,6 +796,18 @@ void ListScreen::updateAnalogScroll() {
     }
 }
 
+// Scroll easing, a held stick, or finished images still waiting for their upload budget
+bool ListScreen::isAnimating() {
+    return scrollOffsetAnim != (float)scrollOffset || axisHeldStart != 0 || ImageFetch::hasResults(fetchOwner);
+}
+
+void ListScreen::activateItem(int index) {
+    if (index < 0 || index >= items.size()) return;
+    selectedIndex = index;
+    if (onItemSelected1) onItemSelected1(items[index]);
+    if (onItemSelected2) onItemSelected2(items[index], index);
+}
+
 // --- Input Handling -----------------------------------------------------------------------
 void ListScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
     // --- Trigger Filter modal only if not in console menu ---
@@ -761,10 +854,7 @@ void ListScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
                         scrollOffset++;
                     }
                 } else if (pagination.totalPages > 1 && pagination.currentPage < pagination.totalPages && onPageChange) {
-                    if (!loadingMore) {
-                        loadingMore = true;
-                        onPageChange(pagination.currentPage + 1);
-                    }
+                    if (!loadingMore) requestNextPage();
                 }
                 break;
             case BUTTON_DPAD_LEFT:
@@ -783,11 +873,13 @@ void ListScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
                 if (pagination.totalPages > 1 && pagination.currentPage > 1) {
                     int targetPage = pagination.currentPage - 1;
                     if (targetPage < 1) break;
-                    // For Hexrom use scraper directly; Gamulator simple backward not implemented (could be added)
-                    if (!isGamulator(romSite)) {
-                        HexromScraper s; auto result = s.fetchGames(pagination.baseUrl, targetPage);
-                        items = result.first; pagination = result.second;
-                        selectedIndex = 0; scrollOffset = 0; textures.clear(); textures.resize(items.size(), nullptr);
+                    // Gamulator simple backward not implemented (could be added)
+                    if (!isGamulator(romSite) && !query.busy) {
+                        std::string baseUrl = pagination.baseUrl;
+                        std::shared_ptr<SiteScraper> scraper = pageScraper();
+                        startQuery([scraper, baseUrl, targetPage] {
+                            return scraper->fetchGames(baseUrl, targetPage);
+                        }, true, "Loading page " + std::to_string(targetPage) + "...");
                     }
                     return;
                 }
@@ -799,20 +891,14 @@ void ListScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
                     if (newIndex >= items.size()) newIndex = items.size() - 1;
                     selectedIndex = newIndex;
                     scrollOffset = (selectedIndex / currentGridColumns);
-                    onPageChange(pagination.currentPage + 1);
+                    requestNextPage();
                 }
                 break;
             case BUTTON_B: // B = Go back
                 menuSystem.popScreen();
                 break;
             case BUTTON_A: // A = Select
-                {
-                    int index = selectedIndex;
-                    if (index >= 0 && index < items.size()) {
-                        if (onItemSelected1) onItemSelected1(items[index]);
-                        if (onItemSelected2) onItemSelected2(items[index], index);
-                    }
-                }
+                activateItem(selectedIndex);
                 break;
         }
     } else if (e.type == SDL_CONTROLLERAXISMOTION) {
@@ -828,7 +914,7 @@ void ListScreen::handleInput(const SDL_Event& e, MenuSystem& menuSystem) {
                                 scrollOffset++;
                             }
                         } else if (pagination.totalPages > 1 && pagination.currentPage < pagination.totalPages && onPageChange) {
-                            onPageChange(pagination.currentPage + 1);
+                            requestNextPage();
                         }
                     } else {
                         if (selectedIndex - currentGridColumns >= 0) {
@@ -0,0 +1,90 @@
+// TileTextureCache.cpp
+// Byte-budgeted LRU of ListScreen tile images, packed into atlas pages.
+//
+
+#include "include/TileTextureCache.h"
+
+#include <algorithm>
+
+namespace {
+
+// 2048 fits six by nine full-size 332x208 thumbnails and is within every GLES2 driver's limit
+const int kAtlasPageSize = 2048;
+
+} // namespace
+
+TileTextureCache::TileTextureCache(size_t budgetBytes)
+    : budgetBytes(budgetBytes),
+      atlas(kAtlasPageSize, std::max(1, (int)(budgetBytes / ((size_t)kAtlasPageSize * kAtlasPageSize * 4)))) {}
+
+bool TileTextureCache::get(int index, Image& out) {
+    auto it = entries.find(index);
+    if (it == entries.end()) {
+        counters.misses++;
+        return false;
+    }
+    counters.hits++;
+    lruOrder.splice(lruOrder.begin(), lruOrder, it->second.lru);
+    out.texture = atlas.texture(it->second.region.page);
+    out.rect = it->second.region.rect;
+    return true;
+}
+
+bool TileTextureCache::peek(int index, Image& out) const {
+    auto it = entries.find(index);
+    if (it == entries.end()) return false;
+    out.texture = atlas.texture(it->second.region.page);
+    out.rect = it->second.region.rect;
+    return true;
+}
+
+void TileTextureCache::erase(std::unordered_map<int, Entry>::iterator it) {
+    atlas.release(it->second.region);
+    counters.bytes -= it->second.bytes;
+    lruOrder.erase(it->second.lru);
+    entries.erase(it);
+}
+
+// Least recently used entry outside the protected range
+bool TileTextureCache::evictOne() {
+    for (auto it = lruOrder.rbegin(); it != lruOrder.rend(); ++it) {
+        int index = *it;
+        if (index >= protectFirst && index <= protectLast) continue;
+        erase(entries.find(index));
+        evicted.insert(index);
+        counters.evictions++;
+        return true;
+    }
+    return false;
+}
+
+bool TileTextureCache::put(SDL_Renderer* renderer, int index, SDL_Surface* surface) {
+    if (!surface) return false;
+    auto old = entries.find(index);
+    if (old != entries.end()) erase(old);
+    TextureAtlas::Region region;
+    while (!atlas.insert(renderer, surface, region)) {
+        if (!evictOne()) return false;
+    }
+    if (evicted.erase(index)) counters.reloads++;
+    lruOrder.push_front(index);
+    Entry e{region, (size_t)surface->w * surface->h * 4, lruOrder.begin()};
+    counters.bytes += e.bytes;
+    if (counters.bytes > counters.peakBytes) counters.peakBytes = counters.bytes;
+    entries.emplace(index, e);
+    return true;
+}
+
+void TileTextureCache::trim(int first, int last) {
+    protectFirst = first;
+    protectLast = last;
+    while (counters.bytes > budgetBytes && evictOne()) {}
+}
+
+void TileTextureCache::clear() {
+    atlas.clear();
+    entries.clear();
+    lruOrder.clear();
+    evicted.clear();
+    counters.bytes = 0;
+}
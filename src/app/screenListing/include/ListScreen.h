@@ -4,11 +4,7 @@
 #include <iostream>   
 #include <vector>
 #include <functional>
-#include <thread>
-#include <mutex>
-#include <queue>
-#include <map>
-#include <atomic>
+#include <set>
 
 // SDL
 #include <SDL2/SDL.h>
@@ -18,10 +14,17 @@
 
 // Other imports
 #include "OnscreenKeyboard.h"
+#include "TileTextureCache.h"
 #include "../../Screen.h"
 #include "../../../model/ListItem.h"
 #include "../../../model/PaginationInfo.h"
 #include "../../../utils/include/HttpUtils.h"   
+#include "../../../utils/include/ImageFetch.h"
+#include "../../../utils/include/ImageUtils.h"
+#include "../../../utils/include/Profiler.h"
+#include "../../../utils/include/QuadBatch.h"
+#include "../../../utils/include/TaskPool.h"
+#include "../../../utils/include/Sprites.h"
 #include "../../../scraper/Gamulator/include/GamulatorScraper.h"
 #include "../../../scraper/Gamulator/include/GamulatorFilterModal.h"
 #include "../../../scraper/Gamulator/include/GamulatorScraperFilter.h"
@@ -29,6 +32,7 @@
 #include "../../../scraper/Hexrom/include/HexromScraperFilter.h"
 #include "../../../scraper/Romspedia/include/RomspediaFilterModal.h"
 #include "../../../scraper/Hexrom/include/HexromScraper.h"
+#include "../../../scraper/CachingScraper.h"
 #include "../../../utils/include/StringUtils.h"
 #include "../../../utils/include/UiUtils.h"
 #include "../../menuApp/include/MenuSystem.h"
@@ -43,7 +47,6 @@ private:
     std::string title;
     std::string lastFilterUrl;
     std::vector<ListItem> items;
-    std::vector<SDL_Texture*> textures;
     int selectedIndex = 0;
     int scrollOffset = 0;
     float scrollOffsetAnim = 0.0f; // For smooth vertical transition
@@ -58,6 +61,17 @@ private:
     static constexpr int VISIBLE_ROWS = 5;
     static constexpr int ICON_SIZE = 120;
     static constexpr int GAME_ICON_SIZE = 180; // Larger icon for games
+    // Image box inside an image-grid tile; decoded art is downscaled to cover it
+    static constexpr int TILE_IMAGE_W = 332;
+    static constexpr int TILE_IMAGE_H = 208;
+    // Per-frame texture upload budget, whichever runs out first (at least one upload per frame)
+    static constexpr size_t UPLOAD_BUDGET_BYTES = 1024 * 1024;
+    static constexpr Uint32 UPLOAD_BUDGET_MS = 4;
+    // Video memory for tile textures (~55 full-size thumbnails); far-away tiles are evicted
+    static constexpr size_t TEXTURE_BUDGET_BYTES = 16 * 1024 * 1024;
+    TileTextureCache textureCache{TEXTURE_BUDGET_BYTES};
+    QuadBatch imageBatch;
+    struct DrawStats { unsigned long frames = 0, imageQuads = 0, imageDrawCalls = 0; } drawStats;
 
     void loadTexture(SDL_Renderer* renderer, int index);
 
@@ -74,16 +88,17 @@ private:
         return (items.size() + gridColumns - 1) / gridColumns;
     }
 
-    // Multithreaded image loading
-    std::map<int, std::string> pendingDownloads; // index -> image URL
-    std::queue<std::pair<int, std::string>> readyImages; // index, local path
-    std::mutex downloadMutex;
-    std::atomic<bool> stopThreads{false};
-    void startImageLoaderThreads(SDL_Renderer* renderer);
-    void stopImageLoaderThreads();
-    void updateTextures(SDL_Renderer* renderer);
-    std::vector<std::thread> loaderThreads;
+    // Background image loading via the shared ImageFetch scheduler
+    int fetchOwner = 0;
+    int lastViewportRow = 0;       // scroll direction for fetch prioritization
+    void requestImage(int index);
     void queueInitialDownloads();
+    void updateTextures(SDL_Renderer* renderer);
+    void resetTextures();          // destroy all textures and cancel outstanding fetches
+    std::set<int> failedImages;    // indices whose image could not be fetched or decoded
+    bool hasRemoteImage(int index) const {
+        return index >= 0 && index < (int)items.size() && items[index].imagePath.compare(0, 4, "http") == 0;
+    }
 
     int lastAxisValue = 0;
     Uint32 lastAxisTime = 0;
@@ -92,6 +107,38 @@ private:
 
     bool loadingMore = false;
 
+    // Speculative next page: fetched once the viewport is within PREFETCH_ROWS rows of the end
+    // and held until the user gets there, so the page boundary needs no round trip
+    static constexpr int PREFETCH_ROWS = 3;
+    enum class PrefetchState { Idle, InFlight, Ready };
+    struct Prefetch {
+        PrefetchState state = PrefetchState::Idle;
+        std::string baseUrl;
+        int page = 0;
+        bool applyOnArrival = false;   // the user reached the end while it was in flight
+        std::vector<ListItem> items;
+        PaginationInfo pagination;
+        TaskPool::CancelToken task;
+    } prefetch;
+    void maybePrefetch(int totalRows);
+    void dropPrefetch();               // cancel and forget a prefetch that no longer applies
+    void requestNextPage();            // reached the end: append the prefetched page or fetch it
+    void applyPrefetched();
+
+    // Filter, search and page queries run off the UI thread (see onRunQuery). Only the latest
+    // one counts: an older result arriving after a newer query started is dropped.
+    struct PendingQuery {
+        int ticket = 0;
+        bool busy = false;
+        bool replace = false;          // result replaces the list rather than being appended
+        std::string label;             // shown over the grid while a replacing query runs
+        TaskPool::CancelToken task;    // cancelled once a newer query supersedes this one
+    } query;
+    bool siteQueryActive = false;      // list shows filter results: further pages come from runSitePaginate
+
+    // Parent of every background fetch started for this screen; cancelled when it goes away
+    TaskPool::CancelToken tasks;
+
     Mix_Chunk* moveSound = nullptr;
 
     // --- Filter modal UI (site specific via union-style void*) ---
@@ -120,14 +167,23 @@ public:
                std::function<void(int)> pageChangeCallback = nullptr,
                const PaginationInfo& paginationInfo = PaginationInfo());
     std::string romSite;
+    // The site's registered scraper, used for plain page fetches (set by MenuApplication; a
+    // fresh one for romSite otherwise)
+    std::shared_ptr<SiteScraper> scraper;
     ~ListScreen();
     void render(SDL_Renderer* renderer, TTF_Font* font) override;
     void handleInput(const SDL_Event& e, MenuSystem& menuSystem) override;
 
     // Add a getter for the selected texture
-    SDL_Texture* getSelectedTexture() const { return (selectedIndex >= 0 && selectedIndex < textures.size()) ? textures[selectedIndex] : nullptr; }
+    // Tile images live in atlas pages: src receives the region of the returned texture
+    SDL_Texture* getSelectedTexture(SDL_Rect* src = nullptr) const { return getTextureAt(selectedIndex, src); }
     int getSelectedIndex() const { return selectedIndex; }
-    SDL_Texture* getTextureAt(int idx) const { return (idx >= 0 && idx < textures.size()) ? textures[idx] : nullptr; }
+    SDL_Texture* getTextureAt(int idx, SDL_Rect* src = nullptr) const {
+        TileTextureCache::Image image;
+        if (!textureCache.peek(idx, image)) return nullptr;
+        if (src) *src = image.rect;
+        return image.texture;
+    }
 
     // Allow setting the item selected callbacks after construction
     std::function<void(const ListItem&)> onItemSelected1;
@@ -138,11 +194,25 @@ public:
     void setTallGridMode(bool tall) { tallGridMode = tall; }
 
     void updateAnalogScroll();
+    bool isAnimating() override;
 
     void appendItems(const std::vector<ListItem>& newItems, const PaginationInfo& newPagination);
 
     void setLoadingMore(bool loading) { loadingMore = loading; }
 
+    // Starts a background fetch of page of baseUrl whose result comes back through
+    // setPrefetchedPage (set by MenuApplication for game listings); task is cancelled once the
+    // prefetch goes stale or the screen is destroyed
+    std::function<void(const std::string& baseUrl, int page, const TaskPool::CancelToken& task)> onPrefetchPage;
+    void setPrefetchedPage(const std::string& baseUrl, int page, const std::vector<ListItem>& newItems, const PaginationInfo& newPagination);
+
+    // Runs query on a fetch thread and hands its result back through setQueryResult with the
+    // same ticket (set by MenuApplication for game listings; without it queries run inline).
+    // task is cancelled when a newer query starts or the screen is destroyed.
+    using ListQuery = std::function<std::pair<std::vector<ListItem>, PaginationInfo>()>;
+    std::function<void(int ticket, ListQuery query, const TaskPool::CancelToken& task)> onRunQuery;
+    void setQueryResult(int ticket, const std::vector<ListItem>& newItems, const PaginationInfo& newPagination);
+
     // Add a helper to determine if this is a game listing screen
     bool isGameListingScreen() const {
         // Heuristic: if the title contains "ROMs" or "Games", treat as game listing
@@ -154,6 +224,19 @@ public:
     // Get the current pagination base URL (for MenuApplication onPageChange callback)
     std::string getCurrentPaginationBaseUrl() const { return pagination.baseUrl; }
 
+    const std::vector<ListItem>& getItems() const { return items; }
+
+    // Select index and run the item callbacks, as pressing A on it would
+    void activateItem(int index);
+
+    // Image tiles on the current screenful: how many have their image uploaded, and how many
+    // gave up (fetch or decode failed). Used by the scenario runner to time grid population.
+    struct TileProgress { int total = 0, loaded = 0, failed = 0; };
+    TileProgress tileProgress() const;
+
+    // Where tile images are cached (a separate directory while PLUNDER_BASE_URL is set)
+    static const std::string& imageCacheDir();
+
 private:
     // Split out bulky constructor site-specific code for readability
     void setupGamulatorModal();
@@ -161,5 +244,7 @@ private:
     void setupRomspediaModal();
     void runSiteFilter(const std::string& search, int region, int sort, int order, int genre);
     void runSitePaginate(int page);
+    void startQuery(ListQuery fetch, bool replace, const std::string& label);
+    std::shared_ptr<SiteScraper> pageScraper() const;
     void applyNewResult(const std::vector<ListItem>& newItems, const PaginationInfo& newPagination, bool replace = true);
 };
\ No newline at end of file
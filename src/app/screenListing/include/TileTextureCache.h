@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
+// SDL
+#include <SDL2/SDL.h>
+
+// Other imports
+#include "../../../utils/include/TextureAtlas.h"
+
+
+// TileTextureCache owns the tile images of a ListScreen, keyed by item index. Images are
+// packed into a TextureAtlas (so a whole grid draws from one or two textures) and their
+// video memory is kept under a byte budget. When over budget, or when the atlas is full, the
+// least recently drawn images outside the protected (visible) range are evicted; ListScreen
+// fetches them again from the on-disk thumbnail cache when they scroll back into view.
+class TileTextureCache {
+public:
+    struct Stats {
+        unsigned long hits = 0;        // tile drawn with its image
+        unsigned long misses = 0;      // image tile drawn without one (loading or evicted)
+        unsigned long evictions = 0;
+        unsigned long reloads = 0;     // images uploaded again after being evicted
+        size_t bytes = 0;
+        size_t peakBytes = 0;
+    };
+
+    // Image of one tile: a region of an atlas page
+    struct Image {
+        SDL_Texture* texture = nullptr;
+        SDL_Rect rect = {0, 0, 0, 0};
+    };
+
+    explicit TileTextureCache(size_t budgetBytes);
+    TileTextureCache(const TileTextureCache&) = delete;
+    TileTextureCache& operator=(const TileTextureCache&) = delete;
+
+    // Image for index, marked as recently used; counts a hit or miss
+    bool get(int index, Image& out);
+    // Image for index without touching LRU order or counters
+    bool peek(int index, Image& out) const;
+    bool contains(int index) const { return entries.count(index) != 0; }
+    bool empty() const { return entries.empty(); }
+
+    // Upload surface for index into the atlas (replacing any previous image); false if it
+    // doesn't fit even after evicting everything unprotected
+    bool put(SDL_Renderer* renderer, int index, SDL_Surface* surface);
+
+    // Evict until under budget, never touching indices in [protectFirst, protectLast]
+    void trim(int protectFirst, int protectLast);
+
+    // Drop everything (items replaced); counters are kept
+    void clear();
+
+    const Stats& stats() const { return counters; }
+    size_t budget() const { return budgetBytes; }
+    int atlasPages() const { return atlas.pageCount(); }
+    size_t textureBytes() const { return atlas.bytes(); }
+
+private:
+    struct Entry {
+        TextureAtlas::Region region;
+        size_t bytes;
+        std::list<int>::iterator lru;
+    };
+
+    void erase(std::unordered_map<int, Entry>::iterator it);
+    bool evictOne();
+
+    size_t budgetBytes;
+    TextureAtlas atlas;
+    int protectFirst = 0, protectLast = -1;
+    std::list<int> lruOrder;   // most recently used at the front
+    std::unordered_map<int, Entry> entries;
+    std::unordered_set<int> evicted; // indices evicted since the last clear, for reload stats
+    Stats counters;
+};
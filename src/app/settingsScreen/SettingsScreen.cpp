@@ -146,4 +146,6 @@ void SettingsScreen::clearCache() {
     std::cerr << "[DEBUG] Removing cache dir recursively: " << CACHE_PATH << std::endl;
     removeDirRecursive(CACHE_PATH);
     mkdir(CACHE_PATH, 0755); // Recreate empty cache dir
+    HttpCache::reset(); // cached pages are gone, drop their index too
+    CachingScraper::invalidateAll();
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include <errno.h>
 
 #include "../../carousel/include/CarouselMenuScreen.h"
+#include "../../../utils/include/HttpCache.h"
+#include "../../../scraper/CachingScraper.h"
 
 class SettingsScreen : public CarouselMenuScreen {
 public:
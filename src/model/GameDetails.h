@@ -3,7 +3,7 @@
 
 #include <string>
 #include <vector>
-#include "../utils/include/UiUtils.h"
+#include "../utils/include/UiColor.h"
 
 struct GameDetailField {
     std::string label;
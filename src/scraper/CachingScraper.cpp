@@ -0,0 +1,162 @@
+#include "CachingScraper.h"
+#include "../utils/include/SingleFlight.h"
+#include "../utils/include/TaskPool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Small LRU map with a per-entry expiry; callers hold memoMutex
+template <typename V>
+class MemoTable {
+public:
+    MemoTable(size_t capacity, std::chrono::seconds ttl) : capacity(capacity), ttl(ttl) {}
+
+    bool get(const std::string& key, V& out) {
+        auto it = lookup.find(key);
+        if (it == lookup.end()) return false;
+        if (Clock::now() - it->second->stored > ttl) {
+            order.erase(it->second);
+            lookup.erase(it);
+            return false;
+        }
+        order.splice(order.begin(), order, it->second);
+        out = it->second->value;
+        return true;
+    }
+
+    void put(const std::string& key, const V& value) {
+        auto it = lookup.find(key);
+        if (it != lookup.end()) {
+            order.erase(it->second);
+            lookup.erase(it);
+        }
+        order.push_front(Node{key, value, Clock::now()});
+        lookup[key] = order.begin();
+        while (order.size() > capacity) {
+            lookup.erase(order.back().key);
+            order.pop_back();
+        }
+    }
+
+    // Remove every key starting with prefix
+    void erasePrefix(const std::string& prefix) {
+        for (auto it = order.begin(); it != order.end();) {
+            if (it->key.compare(0, prefix.size(), prefix) == 0) {
+                lookup.erase(it->key);
+                it = order.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void clear() {
+        order.clear();
+        lookup.clear();
+    }
+
+private:
+    struct Node {
+        std::string key;
+        V value;
+        Clock::time_point stored;
+    };
+    size_t capacity;
+    std::chrono::seconds ttl;
+    std::list<Node> order; // most recent first
+    std::unordered_map<std::string, typename std::list<Node>::iterator> lookup;
+};
+
+using GamesPage = std::pair<std::vector<ListItem>, PaginationInfo>;
+
+std::mutex memoMutex;
+MemoTable<std::vector<ListItem>> consolesMemo(8, std::chrono::seconds(30 * 60));
+MemoTable<GamesPage> gamesMemo(48, std::chrono::seconds(10 * 60));
+MemoTable<GameDetails> detailsMemo(64, std::chrono::seconds(10 * 60));
+
+// A miss already being scraped is joined rather than scraped and parsed a second time
+SingleFlight<std::vector<ListItem>> consolesFlights;
+SingleFlight<GamesPage> gamesFlights;
+SingleFlight<GameDetails> detailsFlights;
+
+// "site\nurl\npage"; '\n' cannot appear in a url so prefixes are unambiguous
+std::string memoKey(const std::string& site, const std::string& url, int page = 0) {
+    return site + "\n" + url + "\n" + std::to_string(page);
+}
+
+} // namespace
+
+std::vector<ListItem> CachingScraper::fetchConsoles() {
+    std::string key = memoKey(getName(), "");
+    std::vector<ListItem> result;
+    {
+        std::lock_guard<std::mutex> lock(memoMutex);
+        if (consolesMemo.get(key, result)) return result;
+    }
+    return consolesFlights.run(key, [&] {
+        result = inner->fetchConsoles();
+        if (!result.empty() && !TaskPool::cancelled()) {
+            std::lock_guard<std::mutex> lock(memoMutex);
+            consolesMemo.put(key, result);
+        }
+        return result;
+    });
+}
+
+std::pair<std::vector<ListItem>, PaginationInfo> CachingScraper::fetchGames(const std::string& consoleUrl, int page) {
+    std::string key = memoKey(getName(), consoleUrl, page);
+    GamesPage result;
+    {
+        std::lock_guard<std::mutex> lock(memoMutex);
+        if (gamesMemo.get(key, result)) return result;
+    }
+    return gamesFlights.run(key, [&] {
+        result = inner->fetchGames(consoleUrl, page);
+        if (!result.first.empty() && !TaskPool::cancelled()) {
+            std::lock_guard<std::mutex> lock(memoMutex);
+            gamesMemo.put(key, result);
+        }
+        return result;
+    });
+}
+
+GameDetails CachingScraper::fetchGameDetails(const std::string& gameUrl) {
+    std::string key = memoKey(getName(), gameUrl);
+    GameDetails result;
+    {
+        std::lock_guard<std::mutex> lock(memoMutex);
+        if (detailsMemo.get(key, result)) return result;
+    }
+    return detailsFlights.run(key, [&] {
+        result = inner->fetchGameDetails(gameUrl);
+        // The direct link is a second fetch; details without it are a partial result
+        if (!result.title.empty() && !result.downloadUrl.empty() && !TaskPool::cancelled()) {
+            std::lock_guard<std::mutex> lock(memoMutex);
+            detailsMemo.put(key, result);
+        }
+        return result;
+    });
+}
+
+void CachingScraper::invalidate(const std::string& site, const std::string& url) {
+    std::string prefix = site + "\n" + url + "\n";
+    std::lock_guard<std::mutex> lock(memoMutex);
+    consolesMemo.erasePrefix(prefix);
+    gamesMemo.erasePrefix(prefix);
+    detailsMemo.erasePrefix(prefix);
+}
+
+void CachingScraper::invalidateAll() {
+    std::lock_guard<std::mutex> lock(memoMutex);
+    consolesMemo.clear();
+    gamesMemo.clear();
+    detailsMemo.clear();
+    printf("[CachingScraper] Cleared parsed results\n");
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "SiteScraper.h"
+
+// Memoizing decorator for any SiteScraper. Parsed consoles, game pages and game details are
+// kept in a process-wide LRU keyed by (site, url, page), so back-navigation and the ListScreen
+// paging paths skip both the network and the parse. Entries expire after a few minutes.
+// Failed (empty) results, details without a download link and anything scraped by a
+// cancelled task are never stored.
+class CachingScraper : public SiteScraper {
+public:
+    explicit CachingScraper(std::shared_ptr<SiteScraper> inner) : inner(std::move(inner)) {}
+
+    std::string getName() const override { return inner->getName(); }
+    std::vector<ListItem> fetchConsoles() override;
+    std::pair<std::vector<ListItem>, PaginationInfo> fetchGames(const std::string& consoleUrl, int page = 1) override;
+    GameDetails fetchGameDetails(const std::string& gameUrl) override;
+
+    // Drop everything cached for one url of a site (all pages), or for every site
+    static void invalidate(const std::string& site, const std::string& url);
+    static void invalidateAll();
+
+private:
+    std::shared_ptr<SiteScraper> inner;
+};
@@ -18,32 +18,14 @@ std::vector<ListItem> GamulatorScraper::fetchConsoles() {
     if (html.empty()) return result;
     // Load blacklist
     static std::unordered_set<std::string> blacklist = loadBlacklist("res/blacklist.txt");
-    // Match each <div class="thumbnail-home"> ... </div>
-    std::regex blockRe(R"(<div class=\"thumbnail-home\">([\s\S]*?)<\/div>)", std::regex::icase);
-    auto blockBegin = std::sregex_iterator(html.begin(), html.end(), blockRe);
-    auto blockEnd = std::sregex_iterator();
-    for (auto it = blockBegin; it != blockEnd; ++it) {
-        std::string block = (*it)[1].str();
-        // Extract <a href="..."> (first console link)
-        std::smatch urlMatch;
-        std::string url;
-        if (std::regex_search(block, urlMatch, std::regex(R"(<a[^>]+href=\"([^\"]+)\")", std::regex::icase))) {
-            url = urlMatch[1].str();
-            if (url.find("http") != 0) url = "https://www.gamulator.com/" + url;
-        }
-        // Extract <img src="...">
-        std::smatch imgMatch;
-        std::string img;
-        if (std::regex_search(block, imgMatch, std::regex(R"(<img[^>]+src=\"([^\"]+)\")", std::regex::icase))) {
-            img = imgMatch[1].str();
-            if (img.find("http") != 0) img = "https://www.gamulator.com" + img;
-        }
-        // Extract <h3>...</h3>
-        std::smatch nameMatch;
-        std::string name;
-        if (std::regex_search(block, nameMatch, std::regex(R"(<h3[^>]*>([^<]+)<\/h3>)", std::regex::icase))) {
-            name = StringUtils::cleanHtmlText(nameMatch[1].str());
-        }
+    // Each console is a <div class="thumbnail-home"> block
+    for (const auto& block : HtmlParser::findAll(html, "div.thumbnail-home")) {
+        // First console link
+        std::string url = HtmlParser::attrOf(block.inner, "a[href]", "href");
+        if (!url.empty() && url.find("http") != 0) url = "https://www.gamulator.com/" + url;
+        std::string img = HtmlParser::attrOf(block.inner, "img[src]", "src");
+        if (!img.empty() && img.find("http") != 0) img = "https://www.gamulator.com" + img;
+        std::string name = StringUtils::cleanHtmlText(HtmlParser::textOf(block.inner, "h3"));
         // Blacklist filtering
         if (!name.empty() && !url.empty()) {
             if (blacklist.find(name) == blacklist.end()) {
@@ -74,56 +56,36 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraper::fetchGames(co
         return {games, pagination};
     }
 
-    // Regex for each game card
-    std::regex cardRe(R"(<div class=\"card\">[\s\S]*?<a href=\"([^"]+)\">[\s\S]*?<img[^>]+src=\"([^"]+)\"[^>]*alt=\"([^"]*)\"[\s\S]*?<h5 class=\"card-title\">([^<]+)<\/h5>[\s\S]*?<div class=\"opis\">([0-9,]+) downs \/\s*Rating <span class=\"zelena\">([0-9]+)%<\/span>[\s\S]*?<div class=\"hideOverflow\">([\s\S]*?)<\/div>)", std::regex::icase);
-    auto begin = std::sregex_iterator(html.begin(), html.end(), cardRe);
-    auto end = std::sregex_iterator();
-    for (auto it = begin; it != end; ++it) {
-        std::string gameUrl = (*it)[1].str();
-        std::string img = (*it)[2].str();
-        std::string alt = (*it)[3].str();
-        std::string name = StringUtils::cleanHtmlText((*it)[4].str());
-        std::string downloads = (*it)[5].str();
-        std::string rating = (*it)[6].str();
-        std::string tagsBlock = (*it)[7].str();
-        if (gameUrl.find("http") != 0) gameUrl = "https://www.gamulator.com" + gameUrl;
-        if (img.find("http") != 0) img = "https://www.gamulator.com" + img;
-        
-        // Extract console tag from tagsBlock (the emulator button)
-        std::string consoleTag;
-        std::regex consoleRe(R"(<a[^>]+class=\"btn btn-info1[^>]+emulator\"[^>]*>([^<]+)<\/a>)", std::regex::icase);
-        std::smatch consoleMatch;
-        if (std::regex_search(tagsBlock, consoleMatch, consoleRe)) {
-            consoleTag = StringUtils::cleanHtmlText(consoleMatch[1].str());
-        }
-        
-        // Extract genres from tagsBlock (all <a ... rel="tag">GENRE</a> that are NOT emulator buttons)
-        std::string genre;
-        std::regex tagRe(R"(<a[^>]+class=\"btn btn-info btn-xs\"[^>]+rel=\"tag\"[^>]*>([^<]+)<\/a>)", std::regex::icase);
-        auto tagBegin = std::sregex_iterator(tagsBlock.begin(), tagsBlock.end(), tagRe);
-        auto tagEnd = std::sregex_iterator();
-        for (auto tagIt = tagBegin; tagIt != tagEnd; ++tagIt) {
-            std::string tag = StringUtils::cleanHtmlText((*tagIt)[1].str());
-            if (!genre.empty()) genre += ", ";
-            genre += tag;
-        }
-        
-        ListItem item;
-        item.label = name;
-        item.imagePath = img;
-        item.downloadUrl = gameUrl;
-        item.size = downloads + " downloads";
-        item.rating = rating;
-        item.genre = genre;
-        games.push_back(item);
-    }
+    games = parseGameCards(html);
 
     // Pagination: extract current and max page from pagination nav
-    std::regex pageRe(R"(<li class='page-item (?:disabled|active)'><a class='page-link'>([0-9]+)<\/a><\/li>[\s\S]*?<li class='page-item'><a class='page-link' href='[^']*currentpage=([0-9]+))");
-    std::smatch pageMatch;
-    if (std::regex_search(html, pageMatch, pageRe)) {
-        pagination.currentPage = std::stoi(pageMatch[1].str());
-        pagination.totalPages = std::stoi(pageMatch[2].str());
+    // <li class='page-item active'><a class='page-link'>N</a></li> ... <li class='page-item'><a class='page-link' href='...currentpage=M'>
+    int currentPage = 0, totalPages = 0;
+    {
+        HtmlParser::Tokenizer tok(html);
+        HtmlParser::Tag tag, link;
+        while (tok.next("li", tag)) {
+            HtmlParser::Slice cls = tag.attr("class");
+            if (!tok.next(link) || !link.is("a") || link.closing || !link.attr("class").equals("page-link")) continue;
+            if (currentPage == 0) {
+                if (!cls.equals("page-item disabled") && !cls.equals("page-item active")) continue;
+                if (link.hasAttr("href")) continue;
+                std::string text = HtmlParser::textAfter(link, html.data() + html.size()).str();
+                if (!text.empty() && text.find_first_not_of("0123456789") == std::string::npos) currentPage = std::stoi(text);
+            } else if (cls.equals("page-item")) {
+                HtmlParser::Slice href = link.attr("href");
+                const char* param = href.find("currentpage=");
+                if (param == href.end()) continue;
+                std::string digits;
+                for (const char* p = param + 12; p < href.end() && isdigit((unsigned char)*p); ++p) digits += *p;
+                if (!digits.empty()) totalPages = std::stoi(digits);
+                break;
+            }
+        }
+    }
+    if (currentPage > 0 && totalPages > 0) {
+        pagination.currentPage = currentPage;
+        pagination.totalPages = totalPages;
     } else {
         // Fallback: if this is a search (URL contains /search? or search_term_string=), set totalPages high so scrolling always tries to load more
         if (consoleUrl.find("/search?") != std::string::npos || consoleUrl.find("search_term_string=") != std::string::npos) {
@@ -143,26 +105,42 @@ GameDetails GamulatorScraper::fetchGameDetails(const std::string& gameUrl) {
     if (html.empty()) return details;
 
     // Title
-    std::smatch m;
-    if (std::regex_search(html, m, std::regex(R"(<h1[^>]*itemprop=["']name["'][^>]*>([^<]+)</h1>)", std::regex::icase))) {
-        details.title = StringUtils::cleanHtmlText(m[1].str());
-    }
+    details.title = StringUtils::cleanHtmlText(HtmlParser::textOf(html, "h1[itemprop=name]"));
 
     // Image
-    if (std::regex_search(html, m, std::regex(R"(<img[^>]+itemprop=["']image["'][^>]+src=["']([^"']+)["'])", std::regex::icase))) {
-        std::string img = m[1].str();
+    std::string img = HtmlParser::attrOf(html, "img[itemprop=image][src]", "src");
+    if (!img.empty()) {
         if (img.find("http") != 0) img = "https://www.gamulator.com" + img;
         details.iconUrl = img;
     }
 
-    // Table fields
-    auto extractTableField = [&](const char* label) -> std::string {
-        std::regex re(std::string(R"(<td[^>]*>)") + label + R"(</td>\s*<td[^>]*>(.*?)</td>)", std::regex::icase);
-        std::smatch m2;
-        if (std::regex_search(html, m2, re)) {
-            return StringUtils::cleanHtmlText(m2[1].str());
+    // Table fields: <td>Label:</td> <td>value</td>, gathered in one pass
+    std::map<std::string, std::string> tableFields;
+    {
+        const char* docEnd = html.data() + html.size();
+        HtmlParser::Tokenizer tok(html);
+        HtmlParser::Tag tag;
+        while (tok.next("td", tag)) {
+            HtmlParser::Element labelCell = HtmlParser::element(tag, docEnd);
+            tok.seek(labelCell.end);
+            HtmlParser::Tag next;
+            if (!tok.next(next)) break;
+            if (next.closing || !next.is("td") || !HtmlParser::Slice(labelCell.end, next.begin).trimmed().empty()) {
+                tok.seek(next.begin);
+                continue;
+            }
+            std::string label = labelCell.inner.trimmed().str();
+            std::transform(label.begin(), label.end(), label.begin(), ::tolower);
+            HtmlParser::Element valueCell = HtmlParser::element(next, docEnd);
+            if (!tableFields.count(label)) tableFields[label] = StringUtils::cleanHtmlText(HtmlParser::text(valueCell.inner));
+            tok.seek(next.begin);
         }
-        return "";
+    }
+    auto extractTableField = [&](const char* label) -> std::string {
+        std::string key = label;
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+        auto it = tableFields.find(key);
+        return it == tableFields.end() ? "" : it->second;
     };
     details.consoleName = extractTableField("Console/System:");
     details.genre = extractTableField("Genre:");
@@ -197,3 +175,63 @@ GameDetails GamulatorScraper::fetchGameDetails(const std::string& gameUrl) {
 
     return details;
 }
+
+std::vector<ListItem> GamulatorScraper::parseGameCards(const std::string& html) {
+    std::vector<ListItem> games;
+    const char* docEnd = html.data() + html.size();
+    // A card's fields are read from its <div class="card"> up to the next card
+    std::vector<const char*> cardStarts;
+    {
+        HtmlParser::Tokenizer tok(html);
+        HtmlParser::Tag tag;
+        while (tok.next("div[class=card]", tag)) cardStarts.push_back(tag.begin);
+    }
+    for (size_t i = 0; i < cardStarts.size(); ++i) {
+        HtmlParser::Slice card(cardStarts[i], i + 1 < cardStarts.size() ? cardStarts[i + 1] : docEnd);
+        HtmlParser::Tokenizer tok(card);
+        HtmlParser::Tag tag;
+
+        if (!tok.next("a[href]", tag)) continue;
+        std::string gameUrl = tag.attr("href").str();
+        if (!tok.next("img[src]", tag)) continue;
+        std::string img = tag.attr("src").str();
+        HtmlParser::Element title;
+        if (!HtmlParser::find(HtmlParser::Slice(tag.end, card.end()), "h5.card-title", title)) continue;
+        std::string name = StringUtils::cleanHtmlText(HtmlParser::text(title.inner));
+        tok.seek(title.end);
+
+        // <div class="opis">1,234 downs / Rating <span class="zelena">87%</span>
+        if (!tok.next("div.opis", tag)) continue;
+        std::string opis = HtmlParser::textAfter(tag, card.end()).str();
+        size_t digitsEnd = opis.find_first_not_of("0123456789,");
+        if (digitsEnd == 0 || digitsEnd == std::string::npos || opis.compare(digitsEnd, 6, " downs") != 0) continue;
+        std::string downloads = opis.substr(0, digitsEnd);
+        if (!tok.next("span.zelena", tag)) continue;
+        std::string rating = HtmlParser::textAfter(tag, card.end()).str();
+        if (rating.empty() || rating.back() != '%') continue;
+        rating.pop_back();
+
+        if (!tok.next("div.hideOverflow", tag)) continue;
+        HtmlParser::Element tagsBlock = HtmlParser::element(tag, card.end());
+
+        // Genres: every <a class="btn btn-info btn-xs" rel="tag"> (emulator buttons use btn-info1)
+        std::string genre;
+        for (const auto& genreLink : HtmlParser::findAll(tagsBlock.inner, "a[class=\"btn btn-info btn-xs\"][rel=tag]")) {
+            if (!genre.empty()) genre += ", ";
+            genre += StringUtils::cleanHtmlText(HtmlParser::text(genreLink.inner));
+        }
+
+        if (gameUrl.find("http") != 0) gameUrl = "https://www.gamulator.com" + gameUrl;
+        if (img.find("http") != 0) img = "https://www.gamulator.com" + img;
+
+        ListItem item;
+        item.label = name;
+        item.imagePath = img;
+        item.downloadUrl = gameUrl;
+        item.size = downloads + " downloads";
+        item.rating = rating;
+        item.genre = genre;
+        games.push_back(item);
+    }
+    return games;
+}
@@ -1,6 +1,7 @@
 #include "include/GamulatorScraperFilter.h"
 #include <iostream>
 #include <fstream>
+#include <mutex>
 #include <set>
 #include "../../utils/include/StringUtils.h"
 #include "../../utils/include/HttpUtils.h"
@@ -37,74 +38,25 @@ static std::set<std::string> loadGamulatorBlacklist() {
 static std::pair<std::vector<ListItem>, bool> parseAndFilterSearchResults(const std::string& html, const std::string& consolePath, const std::set<std::string>& blacklist) {
     std::vector<ListItem> games;
     
-    // Regex for each game card (same as in GamulatorScraper::fetchGames)
-    std::regex cardRe(R"(<div class=\"card\">[\s\S]*?<a href=\"([^"]+)\">[\s\S]*?<img[^>]+src=\"([^"]+)\"[^>]*alt=\"([^"]*)\"[\s\S]*?<h5 class=\"card-title\">([^<]+)<\/h5>[\s\S]*?<div class=\"opis\">([0-9,]+) downs \/\s*Rating <span class=\"zelena\">([0-9]+)%<\/span>[\s\S]*?<div class=\"hideOverflow\">([\s\S]*?)<\/div>)", std::regex::icase);
-    auto begin = std::sregex_iterator(html.begin(), html.end(), cardRe);
-    auto end = std::sregex_iterator();
+    // Same card parser as GamulatorScraper::fetchGames
+    std::vector<ListItem> cards = GamulatorScraper::parseGameCards(html);
+    int totalGames = (int)cards.size();
     
-    int totalGames = 0;
-    int filteredGames = 0;
-    
-    for (auto it = begin; it != end; ++it) {
-        totalGames++;
-        
-        std::string gameUrl = (*it)[1].str();
-        std::string img = (*it)[2].str();
-        std::string name = StringUtils::cleanHtmlText((*it)[4].str());
-        std::string downloads = (*it)[5].str();
-        std::string rating = (*it)[6].str();
-        std::string tagsBlock = (*it)[7].str();
-        
-        if (gameUrl.find("http") != 0) gameUrl = "https://www.gamulator.com" + gameUrl;
-        if (img.find("http") != 0) img = "https://www.gamulator.com" + img;
-        
+    for (auto& item : cards) {
         // Extract console path from game URL
-        std::string gameConsolePath;
-        std::regex gameConsoleRegex(R"(/roms/([^/?]+))");
-        std::smatch gameConsoleMatch;
-        if (std::regex_search(gameUrl, gameConsoleMatch, gameConsoleRegex)) {
-            gameConsolePath = "/roms/" + gameConsoleMatch[1].str();
-        }
+        std::string gameConsolePath = StringUtils::romsConsolePath(item.downloadUrl);
         
         // Skip if this game is not from the selected console (when console filtering is enabled)
         if (!consolePath.empty() && gameConsolePath != consolePath) {
             continue;
         }
         
-        filteredGames++;
-        
-        // Extract console tag from tagsBlock (the emulator button)
-        std::string consoleTag;
-        std::regex consoleRe(R"(<a[^>]+class=\"btn btn-info1[^>]+emulator\"[^>]*>([^<]+)<\/a>)", std::regex::icase);
-        std::smatch consoleMatch;
-        if (std::regex_search(tagsBlock, consoleMatch, consoleRe)) {
-            consoleTag = StringUtils::cleanHtmlText(consoleMatch[1].str());
-        }
-        
-        // Extract genres from tagsBlock (all <a ... rel="tag">GENRE</a> that are NOT emulator buttons)
-        std::string genre;
-        std::regex tagRe(R"(<a[^>]+class=\"btn btn-info btn-xs\"[^>]+rel=\"tag\"[^>]*>([^<]+)<\/a>)", std::regex::icase);
-        auto tagBegin = std::sregex_iterator(tagsBlock.begin(), tagsBlock.end(), tagRe);
-        auto tagEnd = std::sregex_iterator();
-        for (auto tagIt = tagBegin; tagIt != tagEnd; ++tagIt) {
-            std::string tag = StringUtils::cleanHtmlText((*tagIt)[1].str());
-            if (!genre.empty()) genre += ", ";
-            genre += tag;
-        }
-        
         // Check blacklist
-        if (blacklist.find(name) != blacklist.end()) {
+        if (blacklist.find(item.label) != blacklist.end()) {
             continue;
         }
         
-        ListItem item;
-        item.label = name;
-        item.imagePath = img;
-        item.downloadUrl = gameUrl;
-        item.size = downloads + " downloads";
-        item.rating = rating;
-        item.genre = genre;
-        games.push_back(item);
+        games.push_back(std::move(item));
     }
     
     // Return the filtered games and whether there were any total games found
@@ -117,7 +69,10 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     const std::string& search,
     int page)
 {
-    // Static variable to store previous page results for duplicate detection
+    // Static variable to store previous page results for duplicate detection (queries run on
+    // fetch threads and a superseded one may still be running, so they take turns)
+    static std::mutex trackingMutex;
+    std::lock_guard<std::mutex> lock(trackingMutex);
     static std::vector<std::string> previousPageUrls;
     static int lastPage = 0;
     
@@ -127,12 +82,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     }
     lastPage = page;
     // Extract console path from baseUrl (e.g., "https://www.gamulator.com/roms/game-boy-advance" -> "/roms/game-boy-advance")
-    std::string selectedConsolePath;
-    std::regex consoleRe(R"(/roms/([^/?]+))");
-    std::smatch match;
-    if (std::regex_search(baseUrl, match, consoleRe)) {
-        selectedConsolePath = "/roms/" + match[1].str();
-    }
+    std::string selectedConsolePath = StringUtils::romsConsolePath(baseUrl);
     
     // Gamulator search URL: https://www.gamulator.com/search?search_term_string=SEARCH&currentpage=PAGE
     std::string url = "https://www.gamulator.com/search?search_term_string=";
@@ -167,13 +117,9 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
         for (const auto& game : result.first) {
             // Extract console path from game URL (stored in downloadUrl)
             // e.g., "/roms/nintendo-ds/pokemon-heartgold" -> "/roms/nintendo-ds"
-            std::regex gameConsoleRe(R"(/roms/([^/]+))");
-            std::smatch gameMatch;
-            if (std::regex_search(game.downloadUrl, gameMatch, gameConsoleRe)) {
-                std::string gameConsolePath = "/roms/" + gameMatch[1].str();
-                if (gameConsolePath == selectedConsolePath) {
-                    filteredGames.push_back(game);
-                }
+            std::string gameConsolePath = StringUtils::romsConsolePath(game.downloadUrl);
+            if (!gameConsolePath.empty() && gameConsolePath == selectedConsolePath) {
+                filteredGames.push_back(game);
             }
         }
         
@@ -243,12 +189,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     PaginationInfo pagination;
     
     // Extract console path from consoleUrl (e.g., "/roms/game-boy-advance" from "https://www.gamulator.com/roms/game-boy-advance")
-    std::string consolePath;
-    std::regex consolePathRegex(R"(/roms/([^/?]+))");
-    std::smatch consoleMatch;
-    if (std::regex_search(consoleUrl, consoleMatch, consolePathRegex)) {
-        consolePath = "/roms/" + consoleMatch[1].str();
-    }
+    std::string consolePath = StringUtils::romsConsolePath(consoleUrl);
     
     if (consolePath.empty()) {
         return {games, pagination};
@@ -257,7 +198,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     // Build base search URL - remove any existing currentpage parameter first
     std::string baseUrl = searchUrl;
     if (baseUrl.find("&currentpage=") != std::string::npos) {
-        baseUrl = std::regex_replace(baseUrl, std::regex(R"(&currentpage=\d+)"), "");
+        baseUrl = std::regex_replace(baseUrl, Patterns::currentPageParam(), "");
     }
     
     // Set up pagination info
@@ -267,6 +208,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     
     const int TARGET_GAMES_PER_PAGE = 15; // Target number of games to show per "virtual" page
     const int MAX_SEARCH_PAGES = 20;      // Limit search to prevent infinite loops
+    const int SEARCH_PAGE_WINDOW = 4;     // Search pages fetched concurrently
     
     // Calculate which "virtual" range of filtered games we want
     int startIndex = (page - 1) * TARGET_GAMES_PER_PAGE;
@@ -275,11 +217,8 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
     std::vector<ListItem> allFilteredGames;
     std::set<std::string> seenUrls; // Track URLs to prevent duplicates
     std::string previousPageContent; // Track previous page content to detect when pagination stops working
-    int searchPage = 1;
-    bool foundEnoughGames = false;
     
-    // Keep fetching search pages until we have enough filtered games or hit limits
-    while (searchPage <= MAX_SEARCH_PAGES && !foundEnoughGames) {
+    auto searchPageUrl = [&baseUrl](int searchPage) {
         std::string url = baseUrl;
         if (searchPage > 1) {
             if (url.find("?") != std::string::npos) {
@@ -288,13 +227,17 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
                 url += "?currentpage=" + std::to_string(searchPage);
             }
         }
-        
-        std::string html = HttpUtils::fetchWebContent(url);
-        if (html.empty()) break;
+        return url;
+    };
+    
+    // Keep fetching search pages (a few at a time, merged in page order) until we have enough
+    // filtered games or hit limits
+    HttpUtils::fetchPagesInOrder(searchPageUrl, MAX_SEARCH_PAGES, SEARCH_PAGE_WINDOW, [&](int searchPage, const std::string& html) {
+        if (html.empty()) return false;
         
         // Check if this page content is identical to the previous page (pagination limit reached)
         if (searchPage > 1 && html == previousPageContent) {
-            break;
+            return false;
         }
         previousPageContent = html;
         
@@ -305,13 +248,12 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
         
         // If there are no games at all on this page, we've reached the end of search results
         if (!hasAnyGamesOnPage) {
-            break;
+            return false;
         }
         
         // If there are games on the page but none match our filter, continue to next page
         if (pageGames.empty()) {
-            searchPage++;
-            continue;
+            return true;
         }
         
         // Add games from this search page to our collection, but only if not duplicates
@@ -326,16 +268,12 @@ std::pair<std::vector<ListItem>, PaginationInfo> GamulatorScraperFilter::filterG
         
         // If we didn't add any new games from this page, we might be in a loop
         if (newGamesAdded == 0) {
-            break;
+            return false;
         }
         
-        // Check if we have enough games to satisfy the current virtual page request
-        if (allFilteredGames.size() >= endIndex) {
-            foundEnoughGames = true;
-        }
-        
-        searchPage++;
-    }
+        // Stop once we have enough games to satisfy the current virtual page request
+        return allFilteredGames.size() < (size_t)endIndex;
+    });
     
     // Extract the games for the requested virtual page
     if (startIndex < allFilteredGames.size()) {
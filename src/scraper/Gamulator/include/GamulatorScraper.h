@@ -5,6 +5,8 @@
 #include <regex>
 #include <fstream>
 #include <unordered_set>
+#include <map>
+#include <algorithm>
 
 #include "../../../model/ListItem.h"
 #include "../../../model/PaginationInfo.h"
@@ -12,6 +14,8 @@
 #include "GamulatorScraperDownload.h"
 #include "../../../utils/include/HttpUtils.h"
 #include "../../../utils/include/StringUtils.h"
+#include "../../../utils/include/HtmlParser.h"
+#include "../../../utils/include/Patterns.h"
 
 class GamulatorScraper : public SiteScraper {
 public:
@@ -19,4 +23,7 @@ public:
     std::vector<ListItem> fetchConsoles() override;
     std::pair<std::vector<ListItem>, PaginationInfo> fetchGames(const std::string& consoleUrl, int page) override;
     GameDetails fetchGameDetails(const std::string& gameUrl) override;
+
+    // Game cards of a listing or search results page (shared with GamulatorScraperFilter)
+    static std::vector<ListItem> parseGameCards(const std::string& html);
 };
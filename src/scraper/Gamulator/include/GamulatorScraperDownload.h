@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/HtmlParser.h"
 
 // Extracts the direct download link from a Gamulator /download/ page
 std::string ExtractGamulatorDirectDownloadLink(const std::string& downloadPageUrl);
@@ -11,46 +11,15 @@ std::string ScrapeLatestGitHubReleaseNotes(const std::string& releasesPageUrl) {
             return "Failed to fetch release notes.";
         }
 
-            // Use string search to find all <div class="markdown-body my-3"> blocks, handling nested divs
+            // Every <div class="markdown-body my-3"> block (nested divs handled by the tokenizer)
             std::string allBodies;
             size_t mdCount = 0;
-            const std::string divTag = "<div";
-            const std::string classStr = "class=\"markdown-body my-3\"";
-            size_t pos = 0;
             const size_t maxBlocks = 20;
-            while (mdCount < maxBlocks) {
-                size_t divStart = html.find(divTag, pos);
-                if (divStart == std::string::npos) break;
-                size_t classPos = html.find(classStr, divStart);
-                if (classPos == std::string::npos || classPos - divStart > 200) {
-                    pos = divStart + divTag.size();
-                    continue;
-                }
-                size_t tagEnd = html.find('>', classPos);
-                if (tagEnd == std::string::npos) break;
-                size_t contentStart = tagEnd + 1;
-                // Find the matching closing </div> (handle nested divs)
-                size_t searchPos = contentStart;
-                int depth = 1;
-                while (depth > 0) {
-                    size_t nextOpen = html.find("<div", searchPos);
-                    size_t nextClose = html.find("</div>", searchPos);
-                    if (nextClose == std::string::npos) break;
-                    if (nextOpen != std::string::npos && nextOpen < nextClose) {
-                        depth++;
-                        searchPos = nextOpen + 4;
-                    } else {
-                        depth--;
-                        searchPos = nextClose + 6;
-                    }
-                }
-                size_t divEnd = searchPos;
-                if (depth != 0) break; // Unbalanced divs
-                std::string body = html.substr(contentStart, (divEnd - 6) - contentStart);
+            for (const auto& block : HtmlParser::findAll(html, "div[class=\"markdown-body my-3\"]")) {
+                if (mdCount >= maxBlocks) break;
                 if (!allBodies.empty()) allBodies += "\n\n---\n\n";
-                allBodies += body;
+                allBodies.append(block.inner.begin(), block.inner.end());
                 ++mdCount;
-                pos = divEnd;
             }
             std::cerr << "[GitHubReleasesScraper] markdown-body count: " << mdCount << ", total body size: " << allBodies.size() << std::endl;
             if (allBodies.empty()) {
@@ -118,7 +87,7 @@ std::string ScrapeLatestGitHubReleaseNotes(const std::string& releasesPageUrl) {
         };
         // 6. Remove HTML tags for plain text display
         auto strip_html = [](const std::string& input) -> std::string {
-            return std::regex_replace(input, std::regex("<[^>]+>"), "");
+            return HtmlParser::text(input);
         };
         std::string plain = strip_html(decode_html_entities(formatted));
 
@@ -1,8 +1,9 @@
 #pragma once
 #include <string>
-#include <regex>
+#include <cstring>
 #include <iostream>
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/HtmlParser.h"
 
 // Function to scrape the latest release notes from a GitHub releases page
 // Returns a formatted string with the latest release title and notes, or an error message on failure.
@@ -6,24 +6,6 @@ std::string HexromScraper::getName() const {
     return "Hexrom";
 }
 
-// Helper: normalize console name for blacklist (remove parens, brackets, ROMs, ISO, &, HTML entities, trim, lowercase)
-static std::string normalizeConsoleName(const std::string& name) {
-    std::string s = name;
-    // Remove text in parentheses
-    s = std::regex_replace(s, std::regex(R"(\s*\([^\)]*\))"), "");
-    // Remove text in square brackets
-    s = std::regex_replace(s, std::regex(R"(\s*\[[^\]]*\])"), "");
-    // Remove 'ROM', 'ROMS', 'ISO', '&', and HTML entities
-    s = std::regex_replace(s, std::regex(R"(ROMs?|ISO|&amp;|&|\s{2,})", std::regex_constants::icase), " ");
-    // Remove extra spaces
-    s = std::regex_replace(s, std::regex(R"(^\s+|\s+$)"), "");
-    // Lowercase
-    std::transform(s.begin(), s.end(), s.begin(), ::tolower);
-    // Collapse multiple spaces
-    s = std::regex_replace(s, std::regex(R"(\s{2,})"), " ");
-    return s;
-}
-
 // Global blacklist loader for Hexrom
 static std::set<std::string> loadHexromBlacklist() {
     std::set<std::string> blacklist;
@@ -38,7 +20,7 @@ static std::set<std::string> loadHexromBlacklist() {
             line.erase(std::find_if(line.rbegin(), line.rend(), [](int ch) { return !std::isspace(ch); }).base(), line.end());
             if (!line.empty()) {
                 // Normalize blacklist entry
-                blacklist.insert(normalizeConsoleName(line));
+                blacklist.insert(StringUtils::normalizeConsoleName(line));
             }
         }
     }
@@ -51,20 +33,27 @@ std::vector<ListItem> HexromScraper::fetchConsoles() {
     std::string html = HttpUtils::fetchWebContent("https://hexrom.com/rom-category/");
     if (html.empty()) return consoles;
 
-    std::regex regex(R"(<li><a href=\"([^\"]+)\">([^<]+)</a><span class=\"my-game-count\">(\d+)</span></li>)");
-    auto begin = std::sregex_iterator(html.begin(), html.end(), regex);
-    auto end = std::sregex_iterator();
-    for (auto it = begin; it != end; ++it) {
-        std::smatch match = *it;
-        std::string url = match[1];
-        std::string name = match[2];
-        std::string count = match[3];
+    // <li><a href="URL">NAME</a><span class="my-game-count">N</span></li>
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag tag, anchor;
+    const char* anchorClose = nullptr;
+    while (tok.next(tag)) {
+        if (tag.is("a")) {
+            if (tag.closing) anchorClose = tag.end;
+            else { anchor = tag; anchorClose = nullptr; }
+            continue;
+        }
+        if (!tag.is("span") || !tag.hasClass("my-game-count") || anchorClose != tag.begin) continue;
+        std::string url = anchor.attr("href").str();
+        std::string name = HtmlParser::textAfter(anchor, html.data() + html.size()).str();
+        std::string count = HtmlParser::textAfter(tag, html.data() + html.size()).trimmed().str();
+        if (url.empty() || name.empty() || count.empty() || count.find_first_not_of("0123456789") != std::string::npos) continue;
         ListItem item;
         item.label = name + " (" + count + ")";
         item.downloadUrl = url;
         item.imagePath = "";
         // Blacklist filtering (case-insensitive, normalized) on the label as shown in UI
-        std::string labelNorm = normalizeConsoleName(item.label);
+        std::string labelNorm = StringUtils::normalizeConsoleName(item.label);
         // DEBUG: Print normalized label and check if it's in the blacklist
         std::cout << "[DEBUG] Label: '" << item.label << "' | Normalized: '" << labelNorm << "'\n";
         if (blacklist.find(labelNorm) != blacklist.end()) {
@@ -98,8 +87,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> HexromScraper::fetchGames(const
     std::string url = consoleUrl;
     
     // Handle page parameter properly for URLs with or without existing page segments and query params
-    std::regex pageRegex("/page/\\d+/?", std::regex_constants::icase);
-    url = std::regex_replace(url, pageRegex, "/");
+    url = std::regex_replace(url, Patterns::pageSuffix(), "/");
     
     // Find query parameters
     size_t queryPos = url.find('?');
@@ -119,48 +107,38 @@ std::pair<std::vector<ListItem>, PaginationInfo> HexromScraper::fetchGames(const
     std::string html = HttpUtils::fetchWebContent(url);
     if (html.empty()) return {games, pagination};
 
-    std::regex h2Regex(R"(<h2>(.*?)<\/h2>)");
-    std::regex imgRegex(R"(<img[^>]+data-src=\"([^\"]+)\")");
-    std::regex ratingRegex(R"(<span class=\"rating\">[\s\S]*?([0-9.]+)[^<]*<\/span>)");
-    std::regex aHrefRegex(R"(<a[^>]+href=\"([^\"]+)\"[^>]*>\s*<h2>\s*.*?<\/h2>)");
-    auto h2Begin = std::sregex_iterator(html.begin(), html.end(), h2Regex);
-    auto h2End = std::sregex_iterator();
-    size_t lastPos = 0;
-    for (auto it = h2Begin; it != h2End; ++it) {
-        std::string title = (*it)[1].str();
-        title = StringUtils::cleanHtmlText(title);
-        size_t h2Pos = it->position();
-        size_t h2EndPos = h2Pos + it->length();
-        std::string beforeH2 = html.substr(lastPos, h2Pos - lastPos);
-        // Search for the last image before this h2
-        std::string imageUrl = "";
-        auto imgIt = std::sregex_iterator(beforeH2.begin(), beforeH2.end(), imgRegex);
-        auto imgEnd = std::sregex_iterator();
-        for (auto iit = imgIt; iit != imgEnd; ++iit) {
-            imageUrl = (*iit)[1].str();
+    // One pass over the page: each bare <h2> is a game title; the image and rating are the
+    // last ones seen since the previous title, the link is the first <a> right after it
+    const char* docEnd = html.data() + html.size();
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag tag;
+    std::string imageUrl, rating;
+    while (tok.next(tag)) {
+        if (tag.closing) continue;
+        if (tag.is("img")) {
+            HtmlParser::Slice dataSrc = tag.attr("data-src");
+            if (!dataSrc.empty()) imageUrl = dataSrc.str();
+            continue;
         }
-        // Search for the last rating before this h2
-        std::string rating = "";
-        auto ratingIt = std::sregex_iterator(beforeH2.begin(), beforeH2.end(), ratingRegex);
-        auto ratingEnd = std::sregex_iterator();
-        for (auto rit = ratingIt; rit != ratingEnd; ++rit) {
-            rating = (*rit)[1].str();
+        if (tag.is("span") && tag.attr("class").equals("rating")) {
+            std::string text = HtmlParser::text(HtmlParser::element(tag, docEnd).inner);
+            size_t numStart = text.find_first_of("0123456789.");
+            if (numStart != std::string::npos) rating = text.substr(numStart, text.find_first_not_of("0123456789.", numStart) - numStart);
+            continue;
         }
+        if (!tag.is("h2") || !tag.attrs.trimmed().empty()) continue;
+
+        HtmlParser::Element h2 = HtmlParser::element(tag, docEnd);
+        std::string title = StringUtils::cleanHtmlText(h2.inner.str());
         // Find the first <a href=...> after this h2
-        std::string afterH2 = html.substr(h2EndPos, 500); // Search up to 500 chars after h2
-        std::regex aAfterRegex(R"(<a[^>]+href=\"([^\"]+)\"[^>]*>)");
-        std::smatch aAfterMatch;
-        std::string downloadUrl = "";
-        if (std::regex_search(afterH2, aAfterMatch, aAfterRegex) && aAfterMatch.size() > 1) {
-            downloadUrl = aAfterMatch[1].str();
-            if (downloadUrl.find("http") != 0) {
-                if (!downloadUrl.empty() && downloadUrl[0] == '/')
-                    downloadUrl = "https://hexrom.com" + downloadUrl;
-                else
-                    downloadUrl = "https://hexrom.com/" + downloadUrl;
-            }
+        const char* afterEnd = std::min(h2.end + 500, docEnd); // Search up to 500 chars after h2
+        std::string downloadUrl = HtmlParser::attrOf(HtmlParser::Slice(h2.end, afterEnd), "a[href]", "href");
+        if (!downloadUrl.empty() && downloadUrl.find("http") != 0) {
+            if (downloadUrl[0] == '/')
+                downloadUrl = "https://hexrom.com" + downloadUrl;
+            else
+                downloadUrl = "https://hexrom.com/" + downloadUrl;
         }
-        lastPos = h2EndPos;
         ListItem item;
         // Only use main page info, skip details fetch
         item.label = title;
@@ -168,6 +146,9 @@ std::pair<std::vector<ListItem>, PaginationInfo> HexromScraper::fetchGames(const
         item.imagePath = imageUrl;
         item.downloadUrl = downloadUrl;
         item.rating = rating;
+        imageUrl.clear();
+        rating.clear();
+        tok.seek(h2.end);
         // Filtering: skip non-game entries
         bool isNonGame = false;
         if (item.imagePath.empty() || item.downloadUrl.empty()) {
@@ -193,17 +174,14 @@ std::pair<std::vector<ListItem>, PaginationInfo> HexromScraper::fetchGames(const
             games.push_back(item);
         }
     }
-    // Pagination extraction for Hexrom
-    std::regex navRegex(R"(<div class="navigation">([\s\S]*?)<\/div>)");
-    std::smatch navMatch;
-    if (std::regex_search(html, navMatch, navRegex) && navMatch.size() > 1) {
-        std::string navHtml = navMatch[1].str();
-        std::regex pageRegex(R"(<a[^>]+href=[^>]+>(\d+)<\/a>)");
-        auto pageBegin = std::sregex_iterator(navHtml.begin(), navHtml.end(), pageRegex);
-        auto pageEnd = std::sregex_iterator();
+    // Pagination extraction for Hexrom: highest numbered link in <div class="navigation">
+    HtmlParser::Element nav;
+    if (HtmlParser::find(html, "div[class=navigation]", nav)) {
         int maxPage = 1;
-        for (auto it = pageBegin; it != pageEnd; ++it) {
-            int p = std::stoi((*it)[1].str());
+        for (const auto& link : HtmlParser::findAll(nav.inner, "a[href]")) {
+            std::string text = HtmlParser::text(link.inner);
+            if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) continue;
+            int p = std::stoi(text);
             if (p > maxPage) maxPage = p;
         }
         pagination.totalPages = maxPage;
@@ -217,76 +195,70 @@ GameDetails HexromScraper::fetchGameDetails(const std::string& gameUrl) {
     std::string html = HttpUtils::fetchWebContent(gameUrl);
     if (html.empty()) return details;
 
-    // Only extract title from the <th>Name<td> row in the details table
-    std::regex nameRowRegex(R"(<th>\s*Name\s*<td>([^<]+))", std::regex::icase);
-    std::smatch nameMatch;
-    if (std::regex_search(html, nameMatch, nameRowRegex) && nameMatch.size() > 1) {
-        details.title = StringUtils::cleanHtmlText(nameMatch[1].str());
-    } else {
-        details.title = ""; // No fallback, leave empty if not found
-    }
-    // Extract Size field from details table
-    std::regex sizeRowRegex(R"(<th>\s*Size\s*<td>([^<\n]+))", std::regex::icase);
-    std::smatch sizeMatch;
-    if (std::regex_search(html, sizeMatch, sizeRowRegex) && sizeMatch.size() > 1) {
-        details.fileSize = StringUtils::cleanHtmlText(sizeMatch[1].str());
-    } else {
-        details.fileSize = "";
-    }
-    // Extract Publish (release date)
-    std::regex publishRowRegex(R"(<th>\s*Publish\s*<td>([^<\n]+))", std::regex::icase);
-    std::smatch publishMatch;
-    if (std::regex_search(html, publishMatch, publishRowRegex) && publishMatch.size() > 1) {
-        details.releaseDate = StringUtils::cleanHtmlText(publishMatch[1].str());
-    }
-    // Extract Console (genre or new field)
-    std::regex consoleRowRegex(R"(<th>\s*Console(?:\s*<\/th>|)\s*<td>(.*?)<\/td>)", std::regex::icase);
-    std::smatch consoleMatch;
-    if (std::regex_search(html, consoleMatch, consoleRowRegex) && consoleMatch.size() > 1) {
-        std::string consoleHtml = consoleMatch[1].str();
-        // Extract all <a>...</a> text and join with ' > '
-        std::regex aTagRegex(R"(<a[^>]*>([^<]+)<\/a>)");
-        std::sregex_iterator aIt(consoleHtml.begin(), consoleHtml.end(), aTagRegex);
-        std::sregex_iterator aEnd;
-        std::vector<std::string> parts;
-        for (; aIt != aEnd; ++aIt) {
-            parts.push_back(StringUtils::cleanHtmlText((*aIt)[1].str()));
+    // Details table rows look like <th>Name<td>value (Console/Downloads may close the th first).
+    // Collect every row in one pass, first occurrence of a label wins.
+    const char* docEnd = html.data() + html.size();
+    struct Row { HtmlParser::Tag td; bool closedTh; };
+    std::map<std::string, Row> rows;
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag tag;
+    while (tok.next(tag)) {
+        if (tag.closing || !tag.is("th") || !tag.attrs.trimmed().empty()) continue;
+        std::string label = HtmlParser::textAfter(tag, docEnd).trimmed().str();
+        std::transform(label.begin(), label.end(), label.begin(), ::tolower);
+        HtmlParser::Tag next;
+        if (!tok.next(next)) break;
+        bool closedTh = next.closing && next.is("th");
+        if (closedTh) {
+            const char* thClose = next.end;
+            if (!tok.next(next)) break;
+            if (!HtmlParser::Slice(thClose, next.begin).trimmed().empty()) continue;
         }
-        if (!parts.empty()) {
-            details.consoleName = parts[0];
+        if (next.closing || !next.is("td") || !next.attrs.trimmed().empty() || rows.count(label)) continue;
+        rows[label] = Row{next, closedTh};
+    }
+    // Value text right after the <td>; singleLine stops at the first newline like the old "[^<\n]+"
+    auto rowValue = [&](const char* label, bool allowClosedTh, bool singleLine) -> std::string {
+        auto it = rows.find(label);
+        if (it == rows.end() || (it->second.closedTh && !allowClosedTh)) return "";
+        std::string value = HtmlParser::textAfter(it->second.td, docEnd).str();
+        if (singleLine) value = value.substr(0, value.find('\n'));
+        return StringUtils::cleanHtmlText(value);
+    };
+    details.title = rowValue("name", false, false); // No fallback, leave empty if not found
+    details.fileSize = rowValue("size", false, true);
+    details.releaseDate = rowValue("publish", false, true);
+    details.language = rowValue("language", false, true);
+    details.downloads = rowValue("downloads", true, true);
+    // Console: first <a> text of the cell, else the whole cell
+    auto consoleRow = rows.find("console");
+    if (consoleRow != rows.end()) {
+        HtmlParser::Element cell = HtmlParser::element(consoleRow->second.td, docEnd);
+        HtmlParser::Element link;
+        if (HtmlParser::find(cell.inner, "a", link)) {
+            details.consoleName = StringUtils::cleanHtmlText(HtmlParser::text(link.inner));
         } else {
-            details.consoleName = StringUtils::cleanHtmlText(consoleHtml);
+            details.consoleName = StringUtils::cleanHtmlText(cell.inner.str());
         }
     }
-    // Extract Language
-    std::regex langRowRegex(R"(<th>\s*Language\s*<td>([^<\n]+))", std::regex::icase);
-    std::smatch langMatch;
-    if (std::regex_search(html, langMatch, langRowRegex) && langMatch.size() > 1) {
-        details.language = StringUtils::cleanHtmlText(langMatch[1].str());
-    }
-    // Extract Downloads (support both <th>Downloads<td> and <th>Downloads</th><td>)
-    std::regex downloadsRowRegex(R"(<th>\s*Downloads(?:\s*<\/th>|)\s*<td>([^<\n]+))", std::regex::icase);
-    std::smatch downloadsMatch;
-    if (std::regex_search(html, downloadsMatch, downloadsRowRegex) && downloadsMatch.size() > 1) {
-        details.downloads = StringUtils::cleanHtmlText(downloadsMatch[1].str());
-    }
-    // Extract About/Description section after the details table
-    std::regex tableRegex(R"(<table[\s\S]*?<\/table>)", std::regex::icase);
-    std::smatch tableMatch;
-    std::string aboutText = "";
-    if (std::regex_search(html, tableMatch, tableRegex) && tableMatch.size() > 0) {
-        size_t tableEnd = tableMatch.position(0) + tableMatch.length(0);
-        std::string afterTable = html.substr(tableEnd);
-        std::smatch aboutMatch;
-        std::regex pRegex(R"(<p[^>]*>([\s\S]*?)<\/p>)", std::regex::icase);
-        if (std::regex_search(afterTable, aboutMatch, pRegex) && aboutMatch.size() > 1) {
-            aboutText = aboutMatch[1].str();
-        } else {
-            aboutText = "";
+    // Extract About/Description: first paragraph after the details table
+    HtmlParser::Element table;
+    if (HtmlParser::find(html, "table", table)) {
+        HtmlParser::Element para;
+        std::string aboutText;
+        if (HtmlParser::find(HtmlParser::Slice(table.end, docEnd), "p", para)) {
+            aboutText = HtmlParser::text(para.inner, "\n");
+        }
+        aboutText = StringUtils::cleanHtmlText(aboutText);
+        // Collapse runs of 3+ newlines to a blank line
+        std::string collapsed;
+        collapsed.reserve(aboutText.size());
+        int newlines = 0;
+        for (char c : aboutText) {
+            newlines = c == '\n' ? newlines + 1 : 0;
+            if (newlines <= 2) collapsed += c;
         }
-        aboutText = StringUtils::cleanHtmlText(std::regex_replace(aboutText, std::regex(R"(<[^>]+>)"), "\n"));
-        aboutText = std::regex_replace(aboutText, std::regex(R"(\n{3,})"), "\n\n");
-        details.about = aboutText;
+        details.about = collapsed;
     } else {
         details.about = "";
     }
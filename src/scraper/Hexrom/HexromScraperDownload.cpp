@@ -22,33 +22,16 @@ std::string ExtractHexromDirectDownloadLink(const std::string& detailsPageUrl) {
         return "";
     }
     // Look for <a href="...zip" ...>
-    std::regex zipRe(R"(<a[^>]+href=["']([^"']+\.zip)["'])", std::regex::icase);
-    std::smatch match;
-    if (std::regex_search(html, match, zipRe) && match.size() > 1) {
-    std::string link = match[1].str();
-    printf("[HexromDownload] Direct zip anchor match: %s\n", link.c_str());
-    return link;
+    std::string link = HtmlParser::attrOf(html, "a[href$=.zip]", "href");
+    if (!link.empty()) {
+        printf("[HexromDownload] Direct zip anchor match: %s\n", link.c_str());
+        return link;
     }
     // Fallback: look for any .zip link
-    std::regex urlZipRe(R"(https?://[^"']+\.zip)", std::regex::icase);
-    if (std::regex_search(html, match, urlZipRe) && match.size() > 0) {
-    std::string link = match[0].str();
-    printf("[HexromDownload] Fallback absolute zip match: %s\n", link.c_str());
-    return link;
-    }
-    // Legacy logic: find the first <a href=...> after the details table (for older Hexrom pages)
-    std::regex tableRegex(R"(<table[\s\S]*?<\/table>)", std::regex::icase);
-    std::smatch tableMatch;
-    if (std::regex_search(html, tableMatch, tableRegex) && tableMatch.size() > 0) {
-        size_t tableEnd = tableMatch.position(0) + tableMatch.length(0);
-        std::string afterTable = html.substr(tableEnd);
-        std::regex aAfterRegex(R"(<a[^>]+href=["']([^"']+\.zip)["'][^>]*>)", std::regex::icase);
-        std::smatch aAfterMatch;
-        if (std::regex_search(afterTable, aAfterMatch, aAfterRegex) && aAfterMatch.size() > 1) {
-        std::string link = aAfterMatch[1].str();
-        printf("[HexromDownload] Legacy after-table zip match: %s\n", link.c_str());
+    link = HtmlParser::findAbsoluteUrl(html, {".zip"});
+    if (!link.empty()) {
+        printf("[HexromDownload] Fallback absolute zip match: %s\n", link.c_str());
         return link;
-        }
     }
     printf("[HexromDownload] No zip link found on page: %s\n", downloadPageUrl.c_str());
     return "";
@@ -9,8 +9,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> HexromScraperFilter::filterGame
     std::string url = baseUrl;
     
     // Remove any existing page segments and query parameters to start clean
-    std::regex pageRegex("/page/\\d+/?", std::regex_constants::icase);
-    url = std::regex_replace(url, pageRegex, "/");
+    url = std::regex_replace(url, Patterns::pageSuffix(), "/");
     
     // Remove any existing query parameters (everything after ?)
     size_t queryPos = url.find('?');
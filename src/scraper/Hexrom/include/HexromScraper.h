@@ -4,6 +4,7 @@
 #include <string>
 #include <regex>
 #include <set>
+#include <map>
 #include <fstream>
 #include <algorithm>
 #include <cctype>
@@ -14,6 +15,8 @@
 #include "../../../model/GameDetails.h"
 #include "../../../utils/include/HttpUtils.h"
 #include "../../../utils/include/StringUtils.h"
+#include "../../../utils/include/HtmlParser.h"
+#include "../../../utils/include/Patterns.h"
 
 
 class HexromScraper : public SiteScraper {
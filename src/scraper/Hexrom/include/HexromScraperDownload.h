@@ -1,7 +1,7 @@
 #pragma once
 #include <string>
-#include <regex>
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/HtmlParser.h"
 
 // Extracts the direct .zip download link from a Hexrom game details page
 std::string ExtractHexromDirectDownloadLink(const std::string& detailsPageUrl);
@@ -2,116 +2,108 @@
 
 // Forward declarations
 static std::set<std::string> loadRomspediaBlacklist();
-static std::string normalizeConsoleName(const std::string& name);
-static void parseSearchResults(const std::string& html, std::vector<ListItem>& games, const std::set<std::string>& blacklist);
 
-// Parse search results from HTML
-static void parseSearchResults(const std::string& html, std::vector<ListItem>& games, const std::set<std::string>& blacklist) {
-    // First, let's count how many single-rom divs exist in total
-    std::regex totalBlockRe(R"(<div\s+class=\"single-rom\">)", std::regex::icase);
-    auto totalBlockBegin = std::sregex_iterator(html.begin(), html.end(), totalBlockRe);
-    auto totalBlockEnd = std::sregex_iterator();
-    int totalBlockCount = std::distance(totalBlockBegin, totalBlockEnd);
-    std::cout << "[RomspediaSearchGames] Total single-rom blocks found: " << totalBlockCount << std::endl;
-    
-    // More specific approach: Find all <a href="/roms/..."> tags and then look for the single-rom content that follows
-    std::regex linkRe(R"(<a\s+href=['\"]([^'\"]*\/roms\/[^'\"]+)['\"][^>]*>)", std::regex::icase);
-    auto linkBegin = std::sregex_iterator(html.begin(), html.end(), linkRe);
-    auto linkEnd = std::sregex_iterator();
-    int blockCount = 0;
-    
-    for (auto linkIt = linkBegin; linkIt != linkEnd; ++linkIt) {
-        std::string gameUrl = linkIt->str(1);
-        size_t linkPos = linkIt->position();
-        size_t linkLength = linkIt->length();
-        
-        // Extract name from the <a> tag title attribute
-        std::string linkText = linkIt->str(0); // Full match including <a> tag
-        std::string name;
-        
-        // Look for title attribute in the <a> tag
-        std::regex titleRe(R"(title=\"([^\"]+)\")", std::regex::icase);
-        std::smatch titleMatch;
-        if (std::regex_search(linkText, titleMatch, titleRe)) {
-            name = StringUtils::cleanHtmlText(titleMatch[1].str());
-            // Remove " ROM" suffix if present
-            if (name.length() > 4 && name.substr(name.length() - 4) == " ROM") {
-                name = name.substr(0, name.length() - 4);
-            }
-        }
-        
-        // Look for a single-rom div after this link (within reasonable distance)
-        std::string remaining = html.substr(linkPos + linkLength, std::min(size_t(8000), html.length() - linkPos - linkLength));
-        std::regex singleRomRe(R"(<div\s+class=\"single-rom\">([\s\S]{0,5000}?)<\/div>)", std::regex::icase);
-        std::smatch singleRomMatch;
-        
-        if (std::regex_search(remaining, singleRomMatch, singleRomRe)) {
-            blockCount++;
-            std::string block = singleRomMatch[1].str();
-        
-            // URL was already extracted from outer <a> tag
-            if (!gameUrl.empty() && gameUrl.find("http") != 0) gameUrl = "https://www.romspedia.com" + gameUrl;
-            
-            std::smatch downloadsMatch;
-            std::string downloads;
-            if (std::regex_search(block, downloadsMatch, std::regex(R"(<span\s+class=\"down-number\">([0-9,]+)<\/span>)", std::regex::icase))) {
-                downloads = StringUtils::cleanHtmlText(downloadsMatch[1].str());
-            }
-            std::smatch ratingMatch;
-            std::string rating;
-            if (std::regex_search(block, ratingMatch, std::regex(R"(<div\s+class=\"list-rom-rating\"[^>]*data-rating=\"([0-9.]+)\")", std::regex::icase))) {
-                rating = StringUtils::cleanHtmlText(ratingMatch[1].str());
-            }
-            std::smatch romsImgMatch;
-            std::string romsImgBlock;
-            if (std::regex_search(block, romsImgMatch, std::regex(R"(<div\s+class=\"roms-img\">([\s\S]*?)<\/div>)", std::regex::icase))) {
-                romsImgBlock = romsImgMatch[1].str();
-            }
+static std::string absoluteRomspediaUrl(const std::string& url) {
+    if (url.empty() || url.find("http") == 0) return url;
+    return "https://www.romspedia.com" + url;
+}
+
+// Fields of one <div class="single-rom"> card
+struct SingleRom {
+    std::string downloads;
+    std::string rating;
+    std::string url;     // first link of .roms-img
+    std::string title;   // title attribute of that link
+    std::string img;     // first .webp of the <picture>
+};
 
-            
-            std::string img;
-            std::smatch sourceMatch;
-            if (!romsImgBlock.empty() && std::regex_search(romsImgBlock, sourceMatch, std::regex(R"(<source[^>]+(?:srcset|data-srcset)=\"([^\"]+\.webp)\")", std::regex::icase))) {
-                img = sourceMatch[1].str();
-                if (img.find("http") != 0) img = "https://www.romspedia.com" + img;
-            } else if (!romsImgBlock.empty()) {
-                std::smatch imgMatch;
-                if (std::regex_search(romsImgBlock, imgMatch, std::regex(R"(<img[^>]+(?:src|data-src)=\"([^\"]+\.webp)\")", std::regex::icase))) {
-                    img = imgMatch[1].str();
-                    if (img.find("http") != 0) img = "https://www.romspedia.com" + img;
-                }
+static SingleRom parseSingleRom(HtmlParser::Slice block) {
+    SingleRom rom;
+    rom.downloads = StringUtils::cleanHtmlText(HtmlParser::textOf(block, "span.down-number"));
+    rom.rating = HtmlParser::attrOf(block, "div.list-rom-rating[data-rating]", "data-rating");
+    HtmlParser::Element romsImg;
+    if (!HtmlParser::find(block, "div.roms-img", romsImg)) return rom;
+    rom.url = absoluteRomspediaUrl(HtmlParser::attrOf(romsImg.inner, "a[href]", "href"));
+    rom.title = StringUtils::cleanHtmlText(HtmlParser::attrOf(romsImg.inner, "a[title]", "title"));
+    // Prefer <source srcset>, fall back to <img src>; lazy-loaded variants use data-*
+    HtmlParser::Tokenizer tok(romsImg.inner);
+    HtmlParser::Tag tag;
+    std::string fallback;
+    while (tok.next(tag) && rom.img.empty()) {
+        if (tag.closing) continue;
+        if (tag.is("source")) {
+            for (const char* attr : {"srcset", "data-srcset"}) {
+                HtmlParser::Slice value = tag.attr(attr);
+                if (value.endsWithIgnoreCase(".webp")) { rom.img = value.str(); break; }
             }
-            
-            // Skip category/console links (those without specific game names in URL)
-            bool isGameLink = gameUrl.find("/roms/") != std::string::npos && 
-                             gameUrl.rfind("/") != gameUrl.find("/roms/") + 5; // More than just /roms/console
-            
-            if (!name.empty() && !gameUrl.empty() && isGameLink) {
-                std::string labelNorm = normalizeConsoleName(name);
-                if (blacklist.find(labelNorm) == blacklist.end()) {
-                    ListItem item;
-                    item.label = name;
-                    item.imagePath = img;
-                    item.downloadUrl = gameUrl;
-                    item.size = downloads;
-                    item.rating = rating;
-                    games.push_back(item);
-                }
+        } else if (tag.is("img") && fallback.empty()) {
+            for (const char* attr : {"src", "data-src"}) {
+                HtmlParser::Slice value = tag.attr(attr);
+                if (value.endsWithIgnoreCase(".webp")) { fallback = value.str(); break; }
             }
-        } // Close the if (std::regex_search(remaining, singleRomMatch, singleRomRe)) block
+        }
     }
+    rom.img = absoluteRomspediaUrl(rom.img.empty() ? fallback : rom.img);
+    return rom;
 }
 
-// Helper: normalize console name for blacklist (same as Hexrom)
-static std::string normalizeConsoleName(const std::string& name) {
-    std::string s = name;
-    s = std::regex_replace(s, std::regex(R"(\s*\([^)]+\))"), "");
-    s = std::regex_replace(s, std::regex(R"(\s*\[[^]]+\])"), "");
-    s = std::regex_replace(s, std::regex(R"(ROMs?|ISO|&amp;|&|\s{2,})", std::regex_constants::icase), " ");
-    s = std::regex_replace(s, std::regex(R"(^\s+|\s+$)"), "");
-    std::transform(s.begin(), s.end(), s.begin(), ::tolower);
-    s = std::regex_replace(s, std::regex(R"(\s{2,})"), " ");
-    return s;
+// Parse search results from HTML: every <a href="/roms/console/game" title="NAME ROM"> followed by its single-rom card
+std::vector<ListItem> RomspediaScraper::parseSearchResults(const std::string& html, const std::set<std::string>& blacklist, const std::string& consolePath) {
+    std::vector<ListItem> games;
+    const char* docEnd = html.data() + html.size();
+    int totalLinks = 0;
+    int consoleLinks = 0;
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag link;
+    while (tok.next("a[href*=/roms/]", link)) {
+        // The listing anchors carry href as their first attribute
+        if (!link.attrs.trimmed().startsWith("href=")) continue;
+        std::string gameUrl = link.attr("href").str();
+        if (gameUrl.size() <= gameUrl.find("/roms/") + 6) continue;
+        totalLinks++;
+
+        // Extract console path from game URL
+        if (!consolePath.empty()) {
+            // Skip if this game is not from the selected console
+            if (StringUtils::romsConsolePath(gameUrl) != consolePath) continue;
+            consoleLinks++;
+        }
+
+        std::string name = StringUtils::cleanHtmlText(link.attr("title").str());
+        // Remove " ROM" suffix if present
+        if (name.length() > 4 && name.substr(name.length() - 4) == " ROM") {
+            name = name.substr(0, name.length() - 4);
+        }
+
+        // Look for a single-rom div after this link (within reasonable distance)
+        const char* searchEnd = std::min(link.end + 8000, docEnd);
+        HtmlParser::Element card;
+        if (!HtmlParser::find(HtmlParser::Slice(link.end, searchEnd), "div[class=single-rom]", card)) continue;
+        SingleRom rom = parseSingleRom(card.inner);
+
+        // URL was already extracted from outer <a> tag
+        gameUrl = absoluteRomspediaUrl(gameUrl);
+        // Skip category/console links (those without specific game names in URL)
+        bool isGameLink = gameUrl.find("/roms/") != std::string::npos &&
+                         gameUrl.rfind("/") != gameUrl.find("/roms/") + 5; // More than just /roms/console
+        if (name.empty() || !isGameLink) continue;
+        if (blacklist.find(StringUtils::normalizeConsoleName(name)) != blacklist.end()) continue;
+
+        ListItem item;
+        item.label = name;
+        item.imagePath = rom.img;
+        item.downloadUrl = gameUrl;
+        item.size = rom.downloads;
+        item.rating = rom.rating;
+        games.push_back(item);
+    }
+    if (!consolePath.empty()) {
+        std::cout << "[RomspediaSearchGames] Found " << totalLinks << " total links, " << consoleLinks
+                  << " matching console " << consolePath << ", " << games.size() << " after blacklist filtering" << std::endl;
+    } else {
+        std::cout << "[RomspediaSearchGames] Found " << totalLinks << " links, " << games.size() << " games" << std::endl;
+    }
+    return games;
 }
 
 // Load only Romspedia blacklist entries from blacklist.txt
@@ -131,7 +123,7 @@ static std::set<std::string> loadRomspediaBlacklist() {
                 continue;
             }
             if (inRomspediaSection && !line.empty() && line[0] != '#') {
-                std::string normalized = normalizeConsoleName(line);
+                std::string normalized = StringUtils::normalizeConsoleName(line);
                 blacklist.insert(normalized);
             }
         }
@@ -145,64 +137,59 @@ GameDetails RomspediaScraper::fetchGameDetails(const std::string& gameUrl) {
     if (html.empty()) return details;
 
     // Title
-    std::smatch titleMatch;
-    if (std::regex_search(html, titleMatch, std::regex(R"(<h2[^>]*class=\"main-title-big\">([^<]+)<\/h2>)", std::regex::icase))) {
-        details.title = StringUtils::cleanHtmlText(titleMatch[1].str());
-    }
+    details.title = StringUtils::cleanHtmlText(HtmlParser::textOf(html, "h2.main-title-big"));
 
     // Image (prefer largest <source>, fallback to <img>) - but skip .webp since not supported
-    std::smatch imgMatch;
-    if (std::regex_search(html, imgMatch, std::regex(R"(<source[^>]+srcset=\"([^\"]+)\")", std::regex::icase))) {
-        std::string imageUrl = imgMatch[1].str();
-        // Skip .webp images since they're not supported yet
-        if (imageUrl.find(".webp") == std::string::npos) {
-            details.iconUrl = imageUrl;
-        }
-    } else if (std::regex_search(html, imgMatch, std::regex(R"(<img[^>]+src=\"([^\"]+)\")", std::regex::icase))) {
-        std::string imageUrl = imgMatch[1].str();
-        // Skip .webp images since they're not supported yet
-        if (imageUrl.find(".webp") == std::string::npos) {
-            details.iconUrl = imageUrl;
-        }
+    HtmlParser::Tag sourceTag;
+    HtmlParser::Tokenizer imgTok(html);
+    std::string imageUrl;
+    if (imgTok.next("source[srcset]", sourceTag)) {
+        imageUrl = sourceTag.attr("srcset").str();
+    } else {
+        imageUrl = HtmlParser::attrOf(html, "img[src]", "src");
     }
-
-    // File Size
-    std::smatch sizeMatch;
-    if (std::regex_search(html, sizeMatch, std::regex(R"(<div class=\"view-emulator-detail-name\">Size:<\/div>\s*<div class=\"view-emulator-detail-value\">([^<]+)<\/div>)", std::regex::icase))) {
-        details.fileSize = StringUtils::cleanHtmlText(sizeMatch[1].str());
-    }
-
-    // Console
-    std::smatch consoleMatch;
-    if (std::regex_search(html, consoleMatch, std::regex(R"(<div class=\"view-emulator-detail-name\">Console<\/div>\s*<div class=\"view-emulator-detail-value\">([^<]+)<\/div>)", std::regex::icase))) {
-        details.consoleName = StringUtils::cleanHtmlText(consoleMatch[1].str());
+    // Skip .webp images since they're not supported yet
+    if (imageUrl.find(".webp") == std::string::npos) {
+        details.iconUrl = imageUrl;
     }
 
-    // Genre/Category
-    std::smatch genreMatch;
-    if (std::regex_search(html, genreMatch, std::regex(R"(<div class=\"view-emulator-detail-name\">(Category:|Genre:)<\/div>\s*<div class=\"view-emulator-detail-value\">([^<]+)<\/div>)", std::regex::icase))) {
-        details.genre = StringUtils::cleanHtmlText(genreMatch[2].str());
-    }
-
-    // Release Year
-    std::smatch releaseMatch;
-    if (std::regex_search(html, releaseMatch, std::regex(R"(<div class=\"view-emulator-detail-name\">Release Year:<\/div>\s*<div class=\"view-emulator-detail-value\">([^<]+)<\/div>)", std::regex::icase))) {
-        details.releaseDate = StringUtils::cleanHtmlText(releaseMatch[1].str());
-    }
-
-    // Downloads
-    std::smatch downloadsMatch;
-    if (std::regex_search(html, downloadsMatch, std::regex(R"(<div class=\"view-emulator-detail-name\">Downloads:<\/div>\s*<div class=\"view-emulator-detail-value\">([^<]+)<\/div>)", std::regex::icase))) {
-        details.downloads = StringUtils::cleanHtmlText(downloadsMatch[1].str());
+    // Detail rows: <div class="view-emulator-detail-name">Label</div> <div class="view-emulator-detail-value">value</div>
+    const char* docEnd = html.data() + html.size();
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag tag;
+    while (tok.next("div[class=view-emulator-detail-name]", tag)) {
+        HtmlParser::Element nameCell = HtmlParser::element(tag, docEnd);
+        HtmlParser::Tag valueTag;
+        tok.seek(nameCell.end);
+        if (!tok.next(valueTag)) break;
+        if (valueTag.closing || !valueTag.is("div") || !valueTag.attr("class").equals("view-emulator-detail-value") ||
+            !HtmlParser::Slice(nameCell.end, valueTag.begin).trimmed().empty()) {
+            tok.seek(valueTag.begin);
+            continue;
+        }
+        HtmlParser::Slice label = nameCell.inner;
+        std::string value = StringUtils::cleanHtmlText(HtmlParser::textAfter(valueTag, docEnd).str());
+        if (label.equalsIgnoreCase("Size:")) {
+            if (details.fileSize.empty()) details.fileSize = value;
+        } else if (label.equalsIgnoreCase("Console")) {
+            if (details.consoleName.empty()) details.consoleName = value;
+        } else if (label.equalsIgnoreCase("Category:") || label.equalsIgnoreCase("Genre:")) {
+            if (details.genre.empty()) details.genre = value;
+        } else if (label.equalsIgnoreCase("Release Year:")) {
+            if (details.releaseDate.empty()) details.releaseDate = value;
+        } else if (label.equalsIgnoreCase("Downloads:")) {
+            if (details.downloads.empty()) details.downloads = value;
+        }
     }
 
     // About section (game description)
-    std::smatch aboutMatch;
-    if (std::regex_search(html, aboutMatch, std::regex(R"(<div class=\"padinzi-gore-dole descSec\">[\s\S]*?<article[^>]*>([\s\S]*?)<\/article>)", std::regex::icase))) {
-        std::string aboutHtml = aboutMatch[1].str();
-        // Remove all HTML tags
-        aboutHtml = std::regex_replace(aboutHtml, std::regex(R"(<[^>]+>)"), "");
-        details.about = StringUtils::cleanHtmlText(aboutHtml);
+    HtmlParser::Tag descTag;
+    HtmlParser::Tokenizer descTok(html);
+    if (descTok.next("div[class=\"padinzi-gore-dole descSec\"]", descTag)) {
+        HtmlParser::Element article;
+        if (HtmlParser::find(HtmlParser::Slice(descTag.end, docEnd), "article", article)) {
+            details.about = StringUtils::cleanHtmlText(HtmlParser::text(article.inner));
+        }
     }
 
     // Connect Romspedia direct download link
@@ -230,38 +217,22 @@ std::vector<ListItem> RomspediaScraper::fetchConsoles() {
 	if (html.empty()) return result;
 
 	// Each block: <div class="col-12 col-sm-6 col-md-4 col-lg-3 col-xl-3"> ... <div class="pop-slide"> ... </div> ... </div>
-	std::regex blockRe(R"(<div class=\"col-12 col-sm-6 col-md-4 col-lg-3 col-xl-3\">([\s\S]*?<div class=\"pop-slide\">[\s\S]*?<\/div>[\s\S]*?)<\/div>)", std::regex::icase);
-	auto blockBegin = std::sregex_iterator(html.begin(), html.end(), blockRe);
-	auto blockEnd = std::sregex_iterator();
-	for (auto it = blockBegin; it != blockEnd; ++it) {
-		std::string block = (*it)[1].str();
-		// Extract <a href="...">
-		std::smatch urlMatch;
-		std::string url;
-		if (std::regex_search(block, urlMatch, std::regex(R"(<a[^>]+href=\"([^\"]+)\")", std::regex::icase))) {
-			url = urlMatch[1].str();
-			if (url.find("http") != 0) url = "https://www.romspedia.com/" + url;
-		}
-		// Extract <img ... data-src="...">
-		std::smatch imgMatch;
-		std::string img;
-		if (std::regex_search(block, imgMatch, std::regex(R"(data-src=\"([^\"]+)\")", std::regex::icase))) {
-			img = imgMatch[1].str();
-		} else if (std::regex_search(block, imgMatch, std::regex(R"(src=\"([^\"]+)\")", std::regex::icase))) {
-			img = imgMatch[1].str();
-		}
-		if (!img.empty() && img.find("http") != 0) img = "https://www.romspedia.com" + img;
-		// Extract <h2 class="emulator-title">...</h2>
-		std::smatch nameMatch;
-		std::string name;
-		if (std::regex_search(block, nameMatch, std::regex(R"(<h2[^>]*>([^<]+)<\/h2>)", std::regex::icase))) {
-			name = StringUtils::cleanHtmlText(nameMatch[1].str());
-		}
+	for (const auto& block : HtmlParser::findAll(html, "div[class=\"col-12 col-sm-6 col-md-4 col-lg-3 col-xl-3\"]")) {
+		HtmlParser::Element popSlide;
+		if (!HtmlParser::find(block.inner, "div[class=pop-slide]", popSlide)) continue;
+		std::string url = HtmlParser::attrOf(block.inner, "a[href]", "href");
+		if (!url.empty() && url.find("http") != 0) url = "https://www.romspedia.com/" + url;
+		// Lazy-loaded images keep the real url in data-src
+		std::string img = HtmlParser::attrOf(block.inner, "[data-src]", "data-src");
+		if (img.empty()) img = HtmlParser::attrOf(block.inner, "[src]", "src");
+		img = absoluteRomspediaUrl(img);
+		// <h2 class="emulator-title">...</h2>
+		std::string name = StringUtils::cleanHtmlText(HtmlParser::textOf(block.inner, "h2"));
         if (!name.empty() && !url.empty()) {
             static std::set<std::string> blacklist = loadRomspediaBlacklist();
             // Map console name to folder (replace with your actual mapping function)
             std::string folder = getFolderForScrapedConsole(name); // <-- ensure this function exists and works
-            std::string normalizedName = normalizeConsoleName(name);
+            std::string normalizedName = StringUtils::normalizeConsoleName(name);
             if (blacklist.find(normalizedName) == blacklist.end()) {
                 result.push_back(ListItem{name, img, url});
             }
@@ -285,7 +256,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> RomspediaScraper::fetchGames(co
         // Set up base URL without page parameter for pagination
         std::string baseSearchUrl = consoleUrl;
         if (baseSearchUrl.find("&currentpage=") != std::string::npos) {
-            baseSearchUrl = std::regex_replace(baseSearchUrl, std::regex(R"(&currentpage=\d+)"), "");
+            baseSearchUrl = std::regex_replace(baseSearchUrl, Patterns::currentPageParam(), "");
         }
         pagination.baseUrl = baseSearchUrl;
         pagination.currentPage = page;
@@ -297,7 +268,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> RomspediaScraper::fetchGames(co
         std::string url = baseSearchUrl;
         if (page > 1) {
             if (url.find("&currentpage=") != std::string::npos) {
-                url = std::regex_replace(url, std::regex(R"(&currentpage=\d+)"), "&currentpage=" + std::to_string(page));
+                url = std::regex_replace(url, Patterns::currentPageParam(), "&currentpage=" + std::to_string(page));
             } else if (url.find("?") != std::string::npos) {
                 url += "&currentpage=" + std::to_string(page);
             } else {
@@ -310,7 +281,7 @@ std::pair<std::vector<ListItem>, PaginationInfo> RomspediaScraper::fetchGames(co
         if (html.empty()) return {games, pagination};
         
         // Parse search results (extract games from HTML using title attributes)
-        parseSearchResults(html, games, blacklist);
+        games = parseSearchResults(html, blacklist);
         std::cout << "[RomspediaScraper] Found " << games.size() << " games on search page " << page << std::endl;
         
         return {games, pagination};
@@ -331,85 +302,31 @@ std::pair<std::vector<ListItem>, PaginationInfo> RomspediaScraper::fetchGames(co
     std::string html = HttpUtils::fetchWebContent(url);
     if (html.empty()) return {games, pagination};
 
-    // Step 1: Extract each game card block (outer div)
-    // Chunk-based extraction: match <div class="single-rom"> and capture up to 5000 chars
-    std::regex blockRe(R"(<div\s+class=\"single-rom\">([\s\S]{0,5000})<\/div>)", std::regex::icase);
-    auto blockBegin = std::sregex_iterator(html.begin(), html.end(), blockRe);
-    auto blockEnd = std::sregex_iterator();
-    int matchCount = 0;
-    for (auto it = blockBegin; it != blockEnd; ++it) {
-    ++matchCount;
-    std::string block = it->str();
-        // Extract downloads
-        std::smatch downloadsMatch;
-        std::string downloads;
-        if (std::regex_search(block, downloadsMatch, std::regex(R"(<span\s+class=\"down-number\">([0-9,]+)<\/span>)", std::regex::icase))) {
-            downloads = StringUtils::cleanHtmlText(downloadsMatch[1].str());
-        }
-        // Extract rating
-        std::smatch ratingMatch;
-        std::string rating;
-        if (std::regex_search(block, ratingMatch, std::regex(R"(<div\s+class=\"list-rom-rating\"[^>]*data-rating=\"([0-9.]+)\")", std::regex::icase))) {
-            rating = StringUtils::cleanHtmlText(ratingMatch[1].str());
-        }
-        // Extract .roms-img block
-        std::smatch romsImgMatch;
-        std::string romsImgBlock;
-        if (std::regex_search(block, romsImgMatch, std::regex(R"(<div\s+class=\"roms-img\">([\s\S]*?)<\/div>)", std::regex::icase))) {
-            romsImgBlock = romsImgMatch[1].str();
-        }
-        // Declare gameUrl, img, name at start of loop
-        std::string gameUrl;
-        std::string img;
-        std::string name;
-        // Extract game URL from .roms-img block
-        std::smatch urlMatch;
-        if (!romsImgBlock.empty() && std::regex_search(romsImgBlock, urlMatch, std::regex(R"(<a[^>]+href=\"([^\"]+)\")", std::regex::icase))) {
-            gameUrl = urlMatch[1].str();
-            if (gameUrl.find("http") != 0) gameUrl = "https://www.romspedia.com" + gameUrl;
-        }
-        // Extract first .webp image from <source srcset=...> in <picture> inside .roms-img
-        std::smatch sourceMatch;
-        if (!romsImgBlock.empty() && std::regex_search(romsImgBlock, sourceMatch, std::regex(R"(<source[^>]+srcset=\"([^\"]+\.webp)\")", std::regex::icase))) {
-            img = sourceMatch[1].str();
-            if (img.find("http") != 0) img = "https://www.romspedia.com" + img;
-        } else if (!romsImgBlock.empty()) {
-            std::smatch imgMatch;
-            if (std::regex_search(romsImgBlock, imgMatch, std::regex(R"(<img[^>]+src=\"([^\"]+\.webp)\")", std::regex::icase))) {
-                img = imgMatch[1].str();
-                if (img.find("http") != 0) img = "https://www.romspedia.com" + img;
-            }
-        }
-        // Extract name from 'title' attribute of <a> in .roms-img
-        std::smatch nameMatch;
-        if (!romsImgBlock.empty() && std::regex_search(romsImgBlock, nameMatch, std::regex(R"(<a[^>]+title=\"([^\"]+)\")", std::regex::icase))) {
-            name = StringUtils::cleanHtmlText(nameMatch[1].str());
-        }
-        if (!name.empty() && !gameUrl.empty()) {
-            std::string labelNorm = normalizeConsoleName(name);
+    // Each game is a <div class="single-rom"> card
+    for (const auto& card : HtmlParser::findAll(html, "div[class=single-rom]")) {
+        SingleRom rom = parseSingleRom(card.inner);
+        if (!rom.title.empty() && !rom.url.empty()) {
+            std::string labelNorm = StringUtils::normalizeConsoleName(rom.title);
             if (blacklist.find(labelNorm) == blacklist.end()) {
                 ListItem item;
-                item.label = name;
-                item.imagePath = img;
-                item.downloadUrl = gameUrl;
-                item.size = downloads;
-                item.rating = rating;
+                item.label = rom.title;
+                item.imagePath = rom.img;
+                item.downloadUrl = rom.url;
+                item.size = rom.downloads;
+                item.rating = rom.rating;
                 games.push_back(item);
             }
         }
     }
 
-    // Pagination extraction 
-    std::regex navRegex(R"(<ul class=['\"]pagination['\"][^>]*>([\s\S]*?)<\/ul>)");
-    std::smatch navMatch;
+    // Pagination extraction: highest numbered link in <ul class="pagination">
     int maxPage = page;
-    if (std::regex_search(html, navMatch, navRegex) && navMatch.size() > 1) {
-        std::string navHtml = navMatch[1].str();
-        std::regex pageRegex(R"(<a[^>]+href=[^>]+>(\d+)<\/a>)");
-        auto pageBegin = std::sregex_iterator(navHtml.begin(), navHtml.end(), pageRegex);
-        auto pageEnd = std::sregex_iterator();
-        for (auto it = pageBegin; it != pageEnd; ++it) {
-            int p = std::stoi((*it)[1].str());
+    HtmlParser::Element nav;
+    if (HtmlParser::find(html, "ul[class=pagination]", nav)) {
+        for (const auto& pageLink : HtmlParser::findAll(nav.inner, "a[href]")) {
+            std::string text = HtmlParser::text(pageLink.inner);
+            if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) continue;
+            int p = std::stoi(text);
             if (p > maxPage) maxPage = p;
         }
     }
@@ -422,6 +339,6 @@ std::pair<std::vector<ListItem>, PaginationInfo> RomspediaScraper::fetchGames(co
 bool RomspediaScraper::downloadRom(const GameDetails& details) {
     // Use title for ROM name, sanitize for filesystem
     std::string romName = details.title;
-    romName = std::regex_replace(romName, std::regex(R"([^A-Za-z0-9_\-\.])"), "_");
+    romName = std::regex_replace(romName, Patterns::unsafeFileNameChar(), "_");
     return downloadAndExtractRomspediaZip(details.downloadUrl, details.consoleName, romName);
 }
\ No newline at end of file
@@ -21,18 +21,20 @@ std::string ExtractRomspediaDirectDownloadLink(const std::string& detailsPageUrl
         printf("[RomspediaDownload] Empty HTML for: %s\n", downloadPageUrl.c_str());
         return "";
     }
-    // Look for <a href=\"...zip|rar\" ...>
-    std::regex archiveRe(R"(<a[^>]+href=[\"']([^\"']+\.(zip|rar))[\"'])", std::regex::icase);
-    std::smatch match;
-    if (std::regex_search(html, match, archiveRe) && match.size() > 1) {
-        std::string link = match[1].str();
-        printf("[RomspediaDownload] Direct archive anchor match: %s\n", link.c_str());
-        return link;
+    // Look for <a href="...zip|rar" ...>
+    HtmlParser::Tokenizer tok(html);
+    HtmlParser::Tag tag;
+    while (tok.next("a[href]", tag)) {
+        HtmlParser::Slice href = tag.attr("href");
+        if (href.endsWithIgnoreCase(".zip") || href.endsWithIgnoreCase(".rar")) {
+            std::string link = href.str();
+            printf("[RomspediaDownload] Direct archive anchor match: %s\n", link.c_str());
+            return link;
+        }
     }
     // Fallback: look for any .zip or .rar link
-    std::regex urlArchiveRe(R"(https?://[^\"']+\.(zip|rar))", std::regex::icase);
-    if (std::regex_search(html, match, urlArchiveRe) && match.size() > 0) {
-        std::string link = match[0].str();
+    std::string link = HtmlParser::findAbsoluteUrl(html, {".zip", ".rar"});
+    if (!link.empty()) {
         printf("[RomspediaDownload] Fallback absolute archive match: %s\n", link.c_str());
         return link;
     }
@@ -18,7 +18,9 @@
 #include "../../../model/GameDetails.h"
 #include "../../../utils/include/HttpUtils.h"
 #include "../../../utils/include/StringUtils.h"
-#include "../../../utils/include/UiUtils.h"
+#include "../../../utils/include/HtmlParser.h"
+#include "../../../utils/include/Patterns.h"
+#include "../../../utils/include/UiColor.h"
 #include "../../../app/consolePolicies/ConsoleFolderMap.h"
 
 class RomspediaScraper : public SiteScraper {
@@ -29,4 +31,7 @@ public:
     std::pair<std::vector<ListItem>, PaginationInfo> fetchGames(const std::string& consoleUrl, int page = 1) override;
     GameDetails fetchGameDetails(const std::string& gameUrl) override;
     bool downloadRom(const GameDetails& details);
+
+    // Search results page; consolePath ("/roms/<console>") keeps only that console's games
+    static std::vector<ListItem> parseSearchResults(const std::string& html, const std::set<std::string>& blacklist, const std::string& consolePath = "");
 };
@@ -1,6 +1,5 @@
 #pragma once
 #include <string>
-#include <regex>
 #include <cstdio>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -8,6 +7,7 @@
 #include "../../../app/consolePolicies/ConsoleFolderMap.h"
 #include "../../../app/consolePolicies/ConsoleZipPolicy.h"
 #include "../../../utils/include/HttpUtils.h"
+#include "../../../utils/include/HtmlParser.h"
 class RomspediaScraperDownload {
 public:
     RomspediaScraperDownload();
@@ -0,0 +1,387 @@
+#include "include/HtmlParser.h"
+
+#include <cctype>
+#include <cstring>
+
+namespace HtmlParser {
+namespace {
+
+inline char lower(char c) { return (char)std::tolower((unsigned char)c); }
+inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
+inline bool isNameChar(char c) { return std::isalnum((unsigned char)c) || c == '-' || c == '_' || c == ':'; }
+
+// Case-insensitive search for s in [p, end)
+const char* findIgnoreCase(const char* p, const char* end, const char* s) {
+    size_t n = strlen(s);
+    if (n == 0) return p;
+    char first = lower(s[0]);
+    for (; p + n <= end; ++p) {
+        if (lower(*p) != first) continue;
+        size_t i = 1;
+        while (i < n && lower(p[i]) == lower(s[i])) ++i;
+        if (i == n) return p;
+    }
+    return end;
+}
+
+const char* findStr(const char* p, const char* end, const char* s) {
+    size_t n = strlen(s);
+    if (n == 0) return p;
+    for (; p + n <= end; ++p) {
+        p = (const char*)memchr(p, s[0], end - p);
+        if (!p || p + n > end) return end;
+        if (memcmp(p, s, n) == 0) return p;
+    }
+    return end;
+}
+
+// Calls fn(name, value) for each attribute until it returns true
+template <typename Fn>
+bool forEachAttr(const Slice& attrs, Fn fn) {
+    const char* p = attrs.begin();
+    const char* end = attrs.end();
+    while (p < end) {
+        while (p < end && (isSpace(*p) || *p == '/')) ++p;
+        const char* nameStart = p;
+        while (p < end && !isSpace(*p) && *p != '=' && *p != '>' && *p != '/') ++p;
+        Slice name(nameStart, p);
+        if (name.empty()) { if (p < end) ++p; continue; }
+        while (p < end && isSpace(*p)) ++p;
+        Slice value;
+        if (p < end && *p == '=') {
+            ++p;
+            while (p < end && isSpace(*p)) ++p;
+            if (p < end && (*p == '"' || *p == '\'')) {
+                char quote = *p++;
+                const char* valueStart = p;
+                while (p < end && *p != quote) ++p;
+                value = Slice(valueStart, p);
+                if (p < end) ++p;
+            } else {
+                const char* valueStart = p;
+                while (p < end && !isSpace(*p) && *p != '>') ++p;
+                value = Slice(valueStart, p);
+            }
+        }
+        if (fn(name, value)) return true;
+    }
+    return false;
+}
+
+bool hasToken(const Slice& list, const char* token) {
+    size_t n = strlen(token);
+    const char* p = list.begin();
+    const char* end = list.end();
+    while (p < end) {
+        while (p < end && isSpace(*p)) ++p;
+        const char* start = p;
+        while (p < end && !isSpace(*p)) ++p;
+        if ((size_t)(p - start) == n && memcmp(start, token, n) == 0) return true;
+    }
+    return false;
+}
+
+// Parses "name", "name=value" or name="value" out of a [..] selector part
+void parseAttrTest(const std::string& body, std::string& name, char& op, std::string& value) {
+    size_t eq = body.find('=');
+    if (eq == std::string::npos) { name = body; op = 0; return; }
+    op = '=';
+    size_t nameEnd = eq;
+    if (eq > 0 && (body[eq - 1] == '*' || body[eq - 1] == '^' || body[eq - 1] == '$')) {
+        op = body[eq - 1];
+        nameEnd = eq - 1;
+    }
+    name = body.substr(0, nameEnd);
+    value = body.substr(eq + 1);
+    if (value.size() >= 2 && (value[0] == '"' || value[0] == '\'') && value.back() == value[0])
+        value = value.substr(1, value.size() - 2);
+}
+
+} // namespace
+
+// --- Slice ---------------------------------------------------------------------------
+
+bool Slice::equals(const char* s) const {
+    size_t n = strlen(s);
+    return n == size && memcmp(data, s, n) == 0;
+}
+
+bool Slice::equalsIgnoreCase(const char* s) const {
+    size_t n = strlen(s);
+    if (n != size) return false;
+    for (size_t i = 0; i < n; ++i) if (lower(data[i]) != lower(s[i])) return false;
+    return true;
+}
+
+bool Slice::startsWith(const char* s) const {
+    size_t n = strlen(s);
+    return n <= size && memcmp(data, s, n) == 0;
+}
+
+bool Slice::endsWithIgnoreCase(const char* s) const {
+    size_t n = strlen(s);
+    if (n > size) return false;
+    return Slice(end() - n, end()).equalsIgnoreCase(s);
+}
+
+bool Slice::contains(const char* s) const { return find(s) != end(); }
+
+Slice Slice::trimmed() const {
+    const char* b = begin();
+    const char* e = end();
+    while (b < e && isSpace(*b)) ++b;
+    while (e > b && isSpace(e[-1])) --e;
+    return Slice(b, e);
+}
+
+const char* Slice::find(const char* s) const { return findStr(begin(), end(), s); }
+
+// --- Tag -----------------------------------------------------------------------------
+
+bool Tag::hasAttr(const char* attrName) const {
+    return forEachAttr(attrs, [&](const Slice& n, const Slice&) { return n.equalsIgnoreCase(attrName); });
+}
+
+Slice Tag::attr(const char* attrName) const {
+    Slice out;
+    forEachAttr(attrs, [&](const Slice& n, const Slice& v) {
+        if (!n.equalsIgnoreCase(attrName)) return false;
+        out = v;
+        return true;
+    });
+    return out;
+}
+
+bool Tag::hasClass(const char* cls) const { return hasToken(attr("class"), cls); }
+
+bool Tag::isVoid() const {
+    static const char* voids[] = {"img", "br", "source", "meta", "link", "input", "hr", "area", "base", "col", "embed", "param", "track", "wbr"};
+    for (const char* v : voids) if (is(v)) return true;
+    return false;
+}
+
+// --- Selector ------------------------------------------------------------------------
+
+Selector::Selector(const char* text) {
+    const char* p = text;
+    auto readName = [&]() {
+        const char* start = p;
+        while (*p && *p != '.' && *p != '#' && *p != '[') ++p;
+        return std::string(start, p);
+    };
+    tagName = readName();
+    while (*p) {
+        char kind = *p++;
+        if (kind == '.') {
+            classes.push_back(readName());
+        } else if (kind == '#') {
+            AttrTest t;
+            t.name = "id";
+            t.op = '=';
+            t.value = readName();
+            attrs.push_back(t);
+        } else if (kind == '[') {
+            const char* start = p;
+            while (*p && *p != ']') ++p;
+            AttrTest t;
+            parseAttrTest(std::string(start, p), t.name, t.op, t.value);
+            attrs.push_back(t);
+            if (*p) ++p;
+        }
+    }
+}
+
+bool Selector::matches(const Tag& tag) const {
+    if (tag.closing) return false;
+    if (!tagName.empty() && !tag.is(tagName.c_str())) return false;
+    if (!classes.empty()) {
+        Slice cls = tag.attr("class");
+        for (const auto& c : classes) if (!hasToken(cls, c.c_str())) return false;
+    }
+    for (const auto& t : attrs) {
+        if (t.op == 0) {
+            if (!tag.hasAttr(t.name.c_str())) return false;
+            continue;
+        }
+        bool present = false;
+        Slice v;
+        forEachAttr(tag.attrs, [&](const Slice& n, const Slice& val) {
+            if (!n.equalsIgnoreCase(t.name.c_str())) return false;
+            present = true;
+            v = val;
+            return true;
+        });
+        if (!present) return false;
+        const char* want = t.value.c_str();
+        switch (t.op) {
+            case '=': if (!v.equals(want)) return false; break;
+            case '*': if (!v.contains(want)) return false; break;
+            case '^': if (!v.startsWith(want)) return false; break;
+            case '$': if (!v.endsWithIgnoreCase(want)) return false; break;
+        }
+    }
+    return true;
+}
+
+// --- Tokenizer -----------------------------------------------------------------------
+
+bool Tokenizer::next(Tag& tag) {
+    while (cur < stop) {
+        const char* lt = (const char*)memchr(cur, '<', stop - cur);
+        if (!lt || lt + 1 >= stop) { cur = stop; return false; }
+        const char* p = lt + 1;
+        if (*p == '!') {
+            // <!-- comment --> or <!doctype ...>
+            if (p + 2 < stop && p[1] == '-' && p[2] == '-') {
+                const char* close = findStr(p + 3, stop, "-->");
+                cur = close == stop ? stop : close + 3;
+            } else {
+                const char* gt = (const char*)memchr(p, '>', stop - p);
+                cur = gt ? gt + 1 : stop;
+            }
+            continue;
+        }
+        if (*p == '?') {
+            const char* gt = (const char*)memchr(p, '>', stop - p);
+            cur = gt ? gt + 1 : stop;
+            continue;
+        }
+        bool closing = *p == '/';
+        if (closing) ++p;
+        if (p >= stop || !std::isalpha((unsigned char)*p)) { cur = lt + 1; continue; } // stray '<' in text
+        const char* nameStart = p;
+        while (p < stop && isNameChar(*p)) ++p;
+        Slice name(nameStart, p);
+        // Attributes run to the first '>' outside quotes
+        const char* attrStart = p;
+        char quote = 0;
+        while (p < stop && (quote || *p != '>')) {
+            if (quote) { if (*p == quote) quote = 0; }
+            else if ((*p == '"' || *p == '\'') && p > attrStart && (p[-1] == '=' || isSpace(p[-1]))) quote = *p;
+            ++p;
+        }
+        if (p >= stop) { cur = stop; return false; }
+        tag.name = name;
+        tag.attrs = Slice(attrStart, p);
+        tag.begin = lt;
+        tag.end = p + 1;
+        tag.closing = closing;
+        tag.selfClosing = p > attrStart && p[-1] == '/';
+        cur = tag.end;
+        // Raw text elements: their body is never markup
+        if (!closing && (tag.is("script") || tag.is("style"))) {
+            const char* close = findIgnoreCase(cur, stop, tag.is("script") ? "</script" : "</style");
+            cur = close;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool Tokenizer::next(const Selector& sel, Tag& tag) {
+    while (next(tag)) if (sel.matches(tag)) return true;
+    return false;
+}
+
+// --- Element helpers -----------------------------------------------------------------
+
+Element element(const Tag& open, const char* limit) {
+    Element el;
+    el.open = open;
+    if (open.selfClosing || open.isVoid()) {
+        el.inner = Slice(open.end, open.end);
+        el.end = open.end;
+        return el;
+    }
+    std::string name = open.name.str();
+    Tokenizer tok(Slice(open.end, limit));
+    Tag t;
+    int depth = 1;
+    while (tok.next(t)) {
+        if (!t.name.equalsIgnoreCase(name.c_str())) continue;
+        if (t.closing) {
+            if (--depth == 0) {
+                el.inner = Slice(open.end, t.begin);
+                el.end = t.end;
+                return el;
+            }
+        } else if (!t.selfClosing) {
+            ++depth;
+        }
+    }
+    el.inner = Slice(open.end, limit); // unclosed: take the rest of the scope
+    el.end = limit;
+    return el;
+}
+
+bool find(Slice html, const Selector& sel, Element& out) {
+    Tokenizer tok(html);
+    Tag t;
+    if (!tok.next(sel, t)) return false;
+    out = element(t, html.end());
+    return true;
+}
+
+std::vector<Element> findAll(Slice html, const Selector& sel) {
+    std::vector<Element> out;
+    Tokenizer tok(html);
+    Tag t;
+    while (tok.next(sel, t)) {
+        out.push_back(element(t, html.end()));
+        tok.seek(out.back().end);
+    }
+    return out;
+}
+
+std::string attrOf(Slice html, const Selector& sel, const char* attrName) {
+    Tokenizer tok(html);
+    Tag t;
+    return tok.next(sel, t) ? t.attr(attrName).str() : std::string();
+}
+
+std::string text(Slice html, const char* tagReplacement) {
+    std::string out;
+    out.reserve(html.size);
+    Tokenizer tok(html);
+    Tag t;
+    const char* last = html.begin();
+    while (tok.next(t)) {
+        out.append(last, t.begin - last);
+        out += tagReplacement;
+        last = tok.position();
+    }
+    out.append(last, html.end() - last);
+    return out;
+}
+
+std::string textOf(Slice html, const Selector& sel) {
+    Element el;
+    return find(html, sel, el) ? text(el.inner) : std::string();
+}
+
+Slice textAfter(const Tag& tag, const char* limit) {
+    const char* lt = (const char*)memchr(tag.end, '<', limit - tag.end);
+    return Slice(tag.end, lt ? lt : limit);
+}
+
+std::string findAbsoluteUrl(Slice html, std::initializer_list<const char*> extensions) {
+    const char* p = html.begin();
+    const char* end = html.end();
+    while ((p = findStr(p, end, "http")) != end) {
+        const char* rest = p + 4;
+        if (rest < end && *rest == 's') ++rest;
+        if (end - rest < 3 || memcmp(rest, "://", 3) != 0) { p += 4; continue; }
+        // The url runs until a quote; take its longest prefix ending in a wanted extension
+        const char* runEnd = rest + 3;
+        while (runEnd < end && *runEnd != '"' && *runEnd != '\'') ++runEnd;
+        for (const char* e = runEnd; e > rest + 3; --e) {
+            for (const char* ext : extensions) {
+                if (Slice(rest + 4, e).endsWithIgnoreCase(ext)) return std::string(p, e);
+            }
+        }
+        p += 4;
+    }
+    return "";
+}
+
+}
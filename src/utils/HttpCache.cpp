@@ -0,0 +1,217 @@
+#include "include/HttpCache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+namespace HttpCache {
+namespace {
+
+const char* kCacheDir = "cache/http";
+const size_t kMaxBytes = 16 * 1024 * 1024;
+
+// Freshness per site in seconds; anything older is revalidated before use
+struct SiteTtl { const char* host; long seconds; };
+const SiteTtl kSiteTtls[] = {
+    { "gamulator.com", 6 * 3600 },
+    { "romspedia.com", 6 * 3600 },
+    { "hexrom.com",    3600 },
+    { "github.com",    0 },          // update check must always ask the server
+};
+const long kDefaultTtl = 15 * 60;
+
+long ttlFor(const std::string& url) {
+    size_t hostStart = url.find("://");
+    hostStart = hostStart == std::string::npos ? 0 : hostStart + 3;
+    std::string host = url.substr(hostStart, url.find('/', hostStart) - hostStart);
+    for (const auto& site : kSiteTtls) {
+        size_t n = strlen(site.host);
+        if (host.size() >= n && host.compare(host.size() - n, n, site.host) == 0) return site.seconds;
+    }
+    return kDefaultTtl;
+}
+
+struct IndexEntry {
+    size_t bytes = 0;
+    time_t lastUsed = 0;
+};
+
+std::mutex cacheMutex;
+bool indexLoaded = false;
+std::map<std::string, IndexEntry> index; // key -> size/LRU stamp
+size_t totalBytes = 0;
+
+std::string keyFor(const std::string& url) {
+    return std::to_string(std::hash<std::string>{}(url));
+}
+
+std::string bodyPath(const std::string& key) { return std::string(kCacheDir) + "/" + key + ".body"; }
+std::string metaPath(const std::string& key) { return std::string(kCacheDir) + "/" + key + ".meta"; }
+
+void removeEntryLocked(const std::string& key) {
+    auto it = index.find(key);
+    if (it != index.end()) {
+        totalBytes -= it->second.bytes;
+        index.erase(it);
+    }
+    std::remove(bodyPath(key).c_str());
+    std::remove(metaPath(key).c_str());
+}
+
+// The .meta mtime doubles as the LRU stamp so the order survives restarts
+void loadIndexLocked() {
+    if (indexLoaded) return;
+    indexLoaded = true;
+    index.clear();
+    totalBytes = 0;
+    mkdir("cache", 0755);
+    mkdir(kCacheDir, 0755);
+    DIR* dir = opendir(kCacheDir);
+    if (!dir) return;
+    struct dirent* de;
+    while ((de = readdir(dir))) {
+        std::string name = de->d_name;
+        if (name.size() < 6 || name.compare(name.size() - 5, 5, ".meta") != 0) continue;
+        std::string key = name.substr(0, name.size() - 5);
+        struct stat metaSt, bodySt;
+        if (stat(metaPath(key).c_str(), &metaSt) != 0 || stat(bodyPath(key).c_str(), &bodySt) != 0) {
+            std::remove(metaPath(key).c_str());
+            continue;
+        }
+        IndexEntry e;
+        e.bytes = (size_t)bodySt.st_size;
+        e.lastUsed = metaSt.st_mtime;
+        index[key] = e;
+        totalBytes += e.bytes;
+    }
+    closedir(dir);
+}
+
+void evictLocked() {
+    while (totalBytes > kMaxBytes && !index.empty()) {
+        auto oldest = index.begin();
+        for (auto it = index.begin(); it != index.end(); ++it)
+            if (it->second.lastUsed < oldest->second.lastUsed) oldest = it;
+        removeEntryLocked(oldest->first);
+    }
+}
+
+void markUsedLocked(const std::string& key, time_t now) {
+    index[key].lastUsed = now;
+    utime(metaPath(key).c_str(), nullptr);
+}
+
+bool writeFile(const std::string& path, const std::string& data) {
+    std::string tmp = path + ".part";
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    ok = fclose(f) == 0 && ok;
+    if (ok) ok = rename(tmp.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(tmp.c_str());
+    return ok;
+}
+
+// meta layout: url, stored-at (unix seconds), etag, last-modified, one per line
+struct Meta {
+    std::string url;
+    time_t storedAt = 0;
+    std::string etag;
+    std::string lastModified;
+};
+
+bool readMeta(const std::string& key, Meta& meta) {
+    std::ifstream in(metaPath(key));
+    if (!in) return false;
+    std::string stored;
+    if (!std::getline(in, meta.url) || !std::getline(in, stored)) return false;
+    meta.storedAt = (time_t)std::atoll(stored.c_str());
+    std::getline(in, meta.etag);
+    std::getline(in, meta.lastModified);
+    return true;
+}
+
+bool writeMeta(const std::string& key, const Meta& meta) {
+    std::ostringstream out;
+    out << meta.url << "\n" << (long long)meta.storedAt << "\n" << meta.etag << "\n" << meta.lastModified << "\n";
+    return writeFile(metaPath(key), out.str());
+}
+
+} // namespace
+
+bool lookup(const std::string& url, Entry& out) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    loadIndexLocked();
+    std::string key = keyFor(url);
+    if (index.find(key) == index.end()) return false;
+    Meta meta;
+    if (!readMeta(key, meta) || meta.url != url) return false; // hash collision or torn entry
+    std::ifstream in(bodyPath(key), std::ios::binary);
+    if (!in) { removeEntryLocked(key); return false; }
+    std::ostringstream body;
+    body << in.rdbuf();
+    out.body = body.str();
+    out.etag = meta.etag;
+    out.lastModified = meta.lastModified;
+    time_t now = time(nullptr);
+    out.fresh = now - meta.storedAt < ttlFor(url);
+    markUsedLocked(key, now);
+    return true;
+}
+
+void store(const std::string& url, const std::string& body, const std::string& etag, const std::string& lastModified) {
+    if (body.size() > kMaxBytes / 4) return; // one page must not flush the whole cache
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    loadIndexLocked();
+    std::string key = keyFor(url);
+    removeEntryLocked(key);
+    Meta meta;
+    meta.url = url;
+    meta.storedAt = time(nullptr);
+    meta.etag = etag;
+    meta.lastModified = lastModified;
+    // Settings "Clear Cache" may have removed the directory underneath us
+    mkdir("cache", 0755);
+    mkdir(kCacheDir, 0755);
+    if (!writeFile(bodyPath(key), body) || !writeMeta(key, meta)) {
+        std::remove(bodyPath(key).c_str());
+        std::remove(metaPath(key).c_str());
+        return;
+    }
+    IndexEntry e;
+    e.bytes = body.size();
+    e.lastUsed = meta.storedAt;
+    index[key] = e;
+    totalBytes += e.bytes;
+    evictLocked();
+}
+
+void touch(const std::string& url) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    loadIndexLocked();
+    std::string key = keyFor(url);
+    Meta meta;
+    if (index.find(key) == index.end() || !readMeta(key, meta) || meta.url != url) return;
+    meta.storedAt = time(nullptr);
+    writeMeta(key, meta);
+    markUsedLocked(key, meta.storedAt);
+}
+
+void reset() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    indexLoaded = false;
+    index.clear();
+    totalBytes = 0;
+}
+
+}
@@ -0,0 +1,685 @@
+#include "include/HttpClient.h"
+#include "include/TaskPool.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include <zlib.h>
+
+namespace HttpClient {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* kDefaultUserAgent = "Mozilla/5.0 (X11; Linux x86_64)";
+const char* kCaBundle = "/etc/ssl/certs/ca-certificates.crt";
+
+bool iequals(const std::string& a, const std::string& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (std::tolower((unsigned char)a[i]) != std::tolower((unsigned char)b[i])) return false;
+    return true;
+}
+
+std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+struct Url {
+    bool tls = false;
+    std::string host;
+    int port = 0;
+    std::string target; // path + query
+};
+
+bool parseUrl(const std::string& url, Url& out) {
+    size_t schemeEnd = url.find("://");
+    if (schemeEnd == std::string::npos) return false;
+    std::string scheme = url.substr(0, schemeEnd);
+    std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+    if (scheme == "https") { out.tls = true; out.port = 443; }
+    else if (scheme == "http") { out.tls = false; out.port = 80; }
+    else return false;
+    size_t hostStart = schemeEnd + 3;
+    size_t pathStart = url.find_first_of("/?#", hostStart);
+    std::string authority = url.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+    size_t at = authority.rfind('@');
+    if (at != std::string::npos) authority = authority.substr(at + 1);
+    size_t colon = authority.rfind(':');
+    if (colon != std::string::npos && authority.find(']') == std::string::npos) {
+        out.port = std::atoi(authority.c_str() + colon + 1);
+        authority = authority.substr(0, colon);
+    }
+    out.host = authority;
+    if (out.host.empty() || out.port <= 0) return false;
+    out.target = pathStart == std::string::npos ? "/" : url.substr(pathStart);
+    size_t hash = out.target.find('#');
+    if (hash != std::string::npos) out.target = out.target.substr(0, hash);
+    if (out.target.empty() || out.target[0] != '/') out.target = "/" + out.target;
+    return true;
+}
+
+// url as sent on the wire: rewritten to the base-url override's server unless already aimed at it
+std::string routedUrl(const std::string& url) {
+    const std::string& base = baseUrlOverride();
+    Url target, server;
+    if (base.empty() || !parseUrl(url, target) || !parseUrl(base, server)) return url;
+    if (target.host == server.host && target.port == server.port) return url;
+    return base + "/" + target.host + target.target;
+}
+
+// --- OpenSSL one-time setup ----------------------------------------------------------
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+// OpenSSL 1.0.x is only thread safe with these callbacks installed
+std::vector<std::mutex>* sslLocks = nullptr;
+void sslLockingCallback(int mode, int n, const char*, int) {
+    if (mode & CRYPTO_LOCK) (*sslLocks)[n].lock();
+    else (*sslLocks)[n].unlock();
+}
+#endif
+
+// TLS sessions per host:port so reconnects can skip the full handshake
+std::mutex sessionMutex;
+std::map<std::string, SSL_SESSION*> sessionCache;
+int sslHostIndex = -1;
+
+int onNewSession(SSL* ssl, SSL_SESSION* session) {
+    const std::string* key = static_cast<const std::string*>(SSL_get_ex_data(ssl, sslHostIndex));
+    if (!key) return 0;
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    SSL_SESSION*& slot = sessionCache[*key];
+    if (slot) SSL_SESSION_free(slot);
+    slot = session;
+    return 1; // we keep the reference
+}
+
+void offerSession(SSL* ssl, const std::string& key) {
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    auto it = sessionCache.find(key);
+    if (it != sessionCache.end()) SSL_set_session(ssl, it->second); // takes its own reference
+}
+
+SSL_CTX* sslContext() {
+    static SSL_CTX* ctx = nullptr;
+    static std::once_flag once;
+    std::call_once(once, []() {
+        // A peer closing mid-write must not kill the app
+        signal(SIGPIPE, SIG_IGN);
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+        SSL_library_init();
+        SSL_load_error_strings();
+        sslLocks = new std::vector<std::mutex>(CRYPTO_num_locks());
+        CRYPTO_set_locking_callback(sslLockingCallback);
+#endif
+        ctx = SSL_CTX_new(SSLv23_client_method());
+        if (!ctx) return;
+        SSL_CTX_set_options(ctx, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3);
+        SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER, nullptr);
+        sslHostIndex = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(ctx, onNewSession);
+        if (SSL_CTX_load_verify_locations(ctx, kCaBundle, nullptr) != 1) {
+            printf("[HttpClient] CA bundle %s not loaded, using default paths\n", kCaBundle);
+            SSL_CTX_set_default_verify_paths(ctx);
+        }
+    });
+    return ctx;
+}
+
+int remainingMs(const Clock::time_point& deadline, bool unlimited) {
+    if (unlimited) return -1;
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+    return left > 0 ? (int)left : 0;
+}
+
+// poll() until limit, waking every kCancelCheckMs so a request made by a cancelled pool task
+// gives up (as a timeout) instead of running to its deadline
+const int kCancelCheckMs = 100;
+int pollCancellable(struct pollfd* p, const Clock::time_point& limit, bool unlimited) {
+    while (!TaskPool::cancelled()) {
+        int left = remainingMs(limit, unlimited);
+        bool last = left >= 0 && left <= kCancelCheckMs;
+        int r = poll(p, 1, last ? left : kCancelCheckMs);
+        if (r < 0 && errno == EINTR) continue;
+        if (r != 0 || last) return r;
+    }
+    return 0;
+}
+
+// --- Connection: non-blocking socket with optional TLS, all I/O bounded by a deadline ---
+
+std::string poolKey(const Url& url) {
+    return (url.tls ? "https://" : "http://") + url.host + ":" + std::to_string(url.port);
+}
+
+class Connection {
+public:
+    explicit Connection(const std::string& key) : key(key) {}
+    ~Connection() { close(); }
+
+    const std::string key;     // scheme://host:port, the pool bucket
+    Clock::time_point idleSince;
+    bool resumed = false;      // TLS session was resumed instead of a full handshake
+
+    // Every request on a (possibly reused) connection gets its own deadline
+    void setDeadline(Clock::time_point d, bool unl) { deadline = d; unlimited = unl; }
+
+    // An idle keep-alive socket is only usable if the peer has not closed it
+    // (or sent anything unsolicited) while it sat in the pool
+    bool idleUsable() {
+        if (fd < 0) return false;
+        struct pollfd p = {fd, POLLIN, 0};
+        return poll(&p, 1, 0) == 0;
+    }
+
+    bool open(const Url& url, int connectTimeoutMs, std::string& error) {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        struct addrinfo* res = nullptr;
+        std::string port = std::to_string(url.port);
+        int rc = getaddrinfo(url.host.c_str(), port.c_str(), &hints, &res);
+        if (rc != 0 || !res) { error = std::string("resolve failed: ") + gai_strerror(rc); return false; }
+        Clock::time_point connectDeadline = Clock::now() + std::chrono::milliseconds(connectTimeoutMs);
+        for (struct addrinfo* ai = res; ai && fd < 0; ai = ai->ai_next) {
+            int s = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (s < 0) continue;
+            fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+            if (connect(s, ai->ai_addr, ai->ai_addrlen) == 0 || (errno == EINPROGRESS && waitConnected(s, connectDeadline))) {
+                fd = s;
+            } else {
+                ::close(s);
+            }
+        }
+        freeaddrinfo(res);
+        if (fd < 0) { error = TaskPool::cancelled() ? "cancelled" : "connect failed: " + url.host; return false; }
+        if (!url.tls) return true;
+
+        SSL_CTX* ctx = sslContext();
+        if (!ctx) { error = "TLS unavailable"; return false; }
+        ssl = SSL_new(ctx);
+        SSL_set_fd(ssl, fd);
+        SSL_set_tlsext_host_name(ssl, url.host.c_str());
+        X509_VERIFY_PARAM_set1_host(SSL_get0_param(ssl), url.host.c_str(), 0);
+        SSL_set_ex_data(ssl, sslHostIndex, const_cast<std::string*>(&key));
+        offerSession(ssl, key);
+        while (true) {
+            int r = SSL_connect(ssl);
+            if (r == 1) { resumed = SSL_session_reused(ssl) == 1; return true; }
+            int err = SSL_get_error(ssl, r);
+            if ((err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) && waitFd(err == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT)) continue;
+            char buf[160];
+            ERR_error_string_n(ERR_get_error(), buf, sizeof(buf));
+            error = std::string("TLS handshake failed: ") + buf;
+            return false;
+        }
+    }
+
+    bool writeAll(const std::string& data) {
+        size_t off = 0;
+        while (off < data.size()) {
+            if (ssl) {
+                int r = SSL_write(ssl, data.data() + off, (int)(data.size() - off));
+                if (r > 0) { off += r; continue; }
+                int err = SSL_get_error(ssl, r);
+                if ((err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) && waitFd(err == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT)) continue;
+                return false;
+            }
+            ssize_t r = send(fd, data.data() + off, data.size() - off, MSG_NOSIGNAL);
+            if (r > 0) { off += r; continue; }
+            if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) && waitFd(POLLOUT)) continue;
+            return false;
+        }
+        return true;
+    }
+
+    // Returns bytes read, 0 on orderly close, -1 on error/timeout
+    long readSome(char* buf, size_t cap) {
+        while (true) {
+            if (ssl) {
+                int r = SSL_read(ssl, buf, (int)cap);
+                if (r > 0) return r;
+                int err = SSL_get_error(ssl, r);
+                if (err == SSL_ERROR_ZERO_RETURN) return 0;
+                if ((err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) && waitFd(err == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT)) continue;
+                // Many servers drop TLS without close_notify; treat as EOF
+                if (err == SSL_ERROR_SYSCALL && ERR_peek_error() == 0) return 0;
+                return -1;
+            }
+            ssize_t r = recv(fd, buf, cap, 0);
+            if (r >= 0) return (long)r;
+            if ((errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) && waitFd(POLLIN)) continue;
+            return -1;
+        }
+    }
+
+    void close() {
+        if (ssl) { SSL_free(ssl); ssl = nullptr; }
+        if (fd >= 0) { ::close(fd); fd = -1; }
+    }
+
+private:
+    int fd = -1;
+    SSL* ssl = nullptr;
+    Clock::time_point deadline;
+    bool unlimited = false;
+
+    bool waitFd(short events) {
+        struct pollfd p = {fd, events, 0};
+        return pollCancellable(&p, deadline, unlimited) > 0;
+    }
+
+    bool waitConnected(int s, const Clock::time_point& connectDeadline) {
+        Clock::time_point limit = unlimited ? connectDeadline : std::min(connectDeadline, deadline);
+        struct pollfd p = {s, POLLOUT, 0};
+        if (pollCancellable(&p, limit, false) <= 0) return false;
+        int soErr = 0;
+        socklen_t len = sizeof(soErr);
+        getsockopt(s, SOL_SOCKET, SO_ERROR, &soErr, &len);
+        return soErr == 0;
+    }
+};
+
+// Buffered line/body reader on top of a Connection
+class Reader {
+public:
+    explicit Reader(Connection& conn) : conn(conn) {}
+
+    bool readLine(std::string& line) {
+        line.clear();
+        while (true) {
+            for (size_t i = pos; i < len; ++i) {
+                if (buf[i] == '\n') {
+                    line.append(buf + pos, i - pos);
+                    pos = i + 1;
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    return true;
+                }
+            }
+            line.append(buf + pos, len - pos);
+            pos = len = 0;
+            if (line.size() > 64 * 1024 || !fill()) return false;
+        }
+    }
+
+    // Pass up to `count` bytes (or until EOF when count < 0) to out. Returns false on error/abort.
+    bool readBody(long count, const std::function<bool(const char*, size_t)>& out, bool& eof) {
+        eof = false;
+        while (count != 0) {
+            if (pos == len) {
+                if (!fill()) { eof = true; return count < 0; }
+            }
+            size_t n = len - pos;
+            if (count > 0 && (long)n > count) n = (size_t)count;
+            if (!out(buf + pos, n)) return false;
+            pos += n;
+            if (count > 0) count -= (long)n;
+        }
+        return true;
+    }
+
+    // True when no bytes past the current response are buffered
+    bool drained() const { return pos == len; }
+
+private:
+    Connection& conn;
+    char buf[16384];
+    size_t pos = 0, len = 0;
+
+    bool fill() {
+        long r = conn.readSome(buf, sizeof(buf));
+        if (r <= 0) return false;
+        pos = 0;
+        len = (size_t)r;
+        return true;
+    }
+};
+
+bool readHeaders(Reader& reader, Response& resp, std::string& statusLine) {
+    std::string line;
+    // Skip interim 1xx responses
+    do {
+        if (!reader.readLine(line)) return false;
+        // "HTTP/1.1 200 OK"
+        size_t sp = line.find(' ');
+        if (line.compare(0, 5, "HTTP/") != 0 || sp == std::string::npos) return false;
+        statusLine = line;
+        resp.status = std::atoi(line.c_str() + sp + 1);
+        resp.headers.clear();
+        while (true) {
+            if (!reader.readLine(line)) return false;
+            if (line.empty()) break;
+            size_t colon = line.find(':');
+            if (colon == std::string::npos) continue;
+            resp.headers.emplace_back(trim(line.substr(0, colon)), trim(line.substr(colon + 1)));
+        }
+    } while (resp.status >= 100 && resp.status < 200);
+    return resp.status > 0;
+}
+
+bool readChunked(Reader& reader, const std::function<bool(const char*, size_t)>& out) {
+    std::string line;
+    bool eof = false;
+    while (true) {
+        if (!reader.readLine(line)) return false;
+        long size = std::strtol(line.c_str(), nullptr, 16);
+        if (size < 0) return false;
+        if (size == 0) break;
+        if (!reader.readBody(size, out, eof) || eof) return false;
+        if (!reader.readLine(line)) return false; // CRLF after chunk data
+    }
+    // Trailers until blank line
+    while (reader.readLine(line) && !line.empty()) {}
+    return true;
+}
+
+// Streaming gzip/deflate decoder between the body reader and the caller's output
+class Inflater {
+public:
+    Inflater(bool deflate, const std::function<bool(const char*, size_t)>& out) : deflate(deflate), out(out) {
+        memset(&zs, 0, sizeof(zs));
+    }
+    ~Inflater() { if (started) inflateEnd(&zs); }
+
+    bool feed(const char* data, size_t n) {
+        if (ended || n == 0) return true; // bytes after the end of the stream are ignored
+        if (!started) {
+            // "deflate" should be zlib-wrapped, but some servers send a raw stream
+            unsigned char b0 = (unsigned char)data[0], b1 = n > 1 ? (unsigned char)data[1] : 0;
+            bool zlibHeader = (b0 & 0x0f) == 8 && ((b0 << 8) | b1) % 31 == 0;
+            int windowBits = !deflate ? 15 + 16 : zlibHeader || n < 2 ? 15 : -15;
+            if (inflateInit2(&zs, windowBits) != Z_OK) return false;
+            started = true;
+        }
+        zs.next_in = (Bytef*)data;
+        zs.avail_in = (uInt)n;
+        while (zs.avail_in > 0 && !ended) {
+            zs.next_out = (Bytef*)buf;
+            zs.avail_out = sizeof(buf);
+            int r = inflate(&zs, Z_NO_FLUSH);
+            if (r != Z_OK && r != Z_STREAM_END) return false;
+            size_t got = sizeof(buf) - zs.avail_out;
+            if (got > 0 && !out(buf, got)) return false;
+            ended = r == Z_STREAM_END;
+        }
+        return true;
+    }
+
+    // The whole compressed stream arrived; a truncated one is a failed body. An empty body
+    // (Content-Length: 0 despite Content-Encoding) was never a stream and is fine.
+    bool finished() const { return ended || !started; }
+
+private:
+    bool deflate;
+    const std::function<bool(const char*, size_t)>& out;
+    z_stream zs;
+    bool started = false;
+    bool ended = false;
+    char buf[16384];
+};
+
+std::string buildRequest(const Request& req, const Url& url) {
+    std::string hostHeader = url.host;
+    if ((url.tls && url.port != 443) || (!url.tls && url.port != 80)) hostHeader += ":" + std::to_string(url.port);
+    std::string out;
+    out.reserve(512);
+    out += req.method + " " + url.target + " HTTP/1.1\r\n";
+    out += "Host: " + hostHeader + "\r\n";
+    out += "User-Agent: " + (req.userAgent.empty() ? std::string(kDefaultUserAgent) : req.userAgent) + "\r\n";
+    out += "Accept: */*\r\n";
+    if (req.acceptCompressed) out += "Accept-Encoding: gzip, deflate\r\n";
+    if (!req.referer.empty()) out += "Referer: " + req.referer + "\r\n";
+    for (const auto& h : req.headers) out += h.first + ": " + h.second + "\r\n";
+    out += "Connection: keep-alive\r\n\r\n";
+    return out;
+}
+
+// --- Keep-alive pool -------------------------------------------------------------------
+
+const size_t kMaxIdlePerHost = 4;
+const size_t kMaxIdleTotal = 8;
+const auto kIdleTimeout = std::chrono::seconds(30);
+
+std::mutex poolMutex;
+std::vector<std::unique_ptr<Connection>> idlePool; // oldest first
+PoolStats stats;
+
+void evictExpiredLocked(Clock::time_point now) {
+    for (auto it = idlePool.begin(); it != idlePool.end();) {
+        if (now - (*it)->idleSince > kIdleTimeout) { it = idlePool.erase(it); stats.idleEvicted++; }
+        else ++it;
+    }
+}
+
+// Most recently returned idle connection for this host, or null
+std::unique_ptr<Connection> acquire(const std::string& key) {
+    std::vector<std::unique_ptr<Connection>> dead;
+    std::unique_ptr<Connection> conn;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        evictExpiredLocked(Clock::now());
+        for (size_t i = idlePool.size(); i-- > 0;) {
+            if (idlePool[i]->key != key) continue;
+            std::unique_ptr<Connection> c = std::move(idlePool[i]);
+            idlePool.erase(idlePool.begin() + i);
+            if (c->idleUsable()) { conn = std::move(c); break; }
+            stats.idleEvicted++;
+            dead.push_back(std::move(c)); // closed outside the lock
+        }
+        if (conn) stats.connectionsReused++;
+    }
+    return conn;
+}
+
+void release(std::unique_ptr<Connection> conn) {
+    std::unique_ptr<Connection> victim;
+    std::lock_guard<std::mutex> lock(poolMutex);
+    Clock::time_point now = Clock::now();
+    evictExpiredLocked(now);
+    conn->idleSince = now;
+    size_t sameHost = 0;
+    for (const auto& c : idlePool) if (c->key == conn->key) sameHost++;
+    if (sameHost >= kMaxIdlePerHost) {
+        for (auto it = idlePool.begin(); it != idlePool.end(); ++it) {
+            if ((*it)->key == conn->key) { victim = std::move(*it); idlePool.erase(it); break; }
+        }
+    } else if (idlePool.size() >= kMaxIdleTotal) {
+        victim = std::move(idlePool.front());
+        idlePool.erase(idlePool.begin());
+    }
+    if (victim) stats.idleEvicted++;
+    idlePool.push_back(std::move(conn));
+}
+
+// The server may keep the socket open for another request
+bool reusable(const Response& resp, const std::string& statusLine, bool delimited) {
+    if (!delimited || statusLine.compare(0, 8, "HTTP/1.1") != 0) return false;
+    std::string c = resp.header("Connection");
+    std::transform(c.begin(), c.end(), c.begin(), ::tolower);
+    return c.find("close") == std::string::npos;
+}
+
+} // namespace
+
+std::string Response::header(const std::string& name) const {
+    for (const auto& h : headers) if (iequals(h.first, name)) return h.second;
+    return "";
+}
+
+std::string resolveUrl(const std::string& base, const std::string& ref) {
+    if (ref.empty()) return base;
+    if (ref.find("://") != std::string::npos) return ref;
+    size_t schemeEnd = base.find("://");
+    if (schemeEnd == std::string::npos) return ref;
+    if (ref.compare(0, 2, "//") == 0) return base.substr(0, schemeEnd + 1) + ref;
+    size_t pathStart = base.find_first_of("/?#", schemeEnd + 3);
+    std::string origin = base.substr(0, pathStart);
+    if (ref[0] == '/') return origin + ref;
+    std::string path = pathStart == std::string::npos ? "/" : base.substr(pathStart);
+    size_t cut = path.find_first_of("?#");
+    if (cut != std::string::npos) path = path.substr(0, cut);
+    if (ref[0] == '?') return origin + path + ref;
+    return origin + path.substr(0, path.rfind('/') + 1) + ref;
+}
+
+PoolStats poolStats() {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    PoolStats out = stats;
+    out.idleNow = (int)idlePool.size();
+    return out;
+}
+
+void closeIdleConnections() {
+    std::vector<std::unique_ptr<Connection>> dead;
+    std::lock_guard<std::mutex> lock(poolMutex);
+    dead.swap(idlePool);
+}
+
+const std::string& baseUrlOverride() {
+    static const std::string base = [] {
+        const char* env = getenv("PLUNDER_BASE_URL");
+        std::string value = env ? env : "";
+        while (!value.empty() && value.back() == '/') value.pop_back();
+        if (!value.empty()) printf("[HttpClient] all requests go to %s\n", value.c_str());
+        return value;
+    }();
+    return base;
+}
+
+Response perform(const Request& request, const BodySink& sink) {
+    Response resp;
+    bool unlimited = request.timeoutMs <= 0;
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(unlimited ? 0 : request.timeoutMs);
+    Request req = request;
+    for (int hop = 0; hop <= request.maxRedirects; ++hop) {
+        resp = Response();
+        resp.finalUrl = req.url;
+        if (TaskPool::cancelled()) { resp.error = "cancelled"; return resp; }
+        Url url;
+        if (!parseUrl(routedUrl(req.url), url)) { resp.error = "bad url: " + req.url; return resp; }
+        std::string key = poolKey(url);
+        bool idempotent = req.method == "GET" || req.method == "HEAD";
+        std::unique_ptr<Connection> conn;
+        std::unique_ptr<Reader> reader;
+        std::string statusLine;
+
+        // A pooled socket can die between the liveness check and our write (server idle
+        // timeout); idempotent requests then get one retry on a fresh connection
+        for (int attempt = 0; ; ++attempt) {
+            conn = attempt == 0 ? acquire(key) : nullptr;
+            bool pooled = conn != nullptr;
+            if (!conn) {
+                conn.reset(new Connection(key));
+                conn->setDeadline(deadline, unlimited);
+                if (!conn->open(url, request.connectTimeoutMs, resp.error)) return resp;
+                std::lock_guard<std::mutex> lock(poolMutex);
+                stats.connectionsOpened++;
+                if (url.tls) (conn->resumed ? stats.tlsResumed : stats.tlsFull)++;
+            }
+            conn->setDeadline(deadline, unlimited);
+            bool retry = pooled && idempotent && remainingMs(deadline, unlimited) != 0;
+            if (!conn->writeAll(buildRequest(req, url))) {
+                if (retry) continue;
+                resp.error = "send failed";
+                return resp;
+            }
+            reader.reset(new Reader(*conn));
+            if (!readHeaders(*reader, resp, statusLine)) {
+                if (retry) continue;
+                resp.status = 0;
+                resp.error = TaskPool::cancelled() ? "cancelled" : "bad or missing response headers";
+                return resp;
+            }
+            break;
+        }
+
+        bool redirect = resp.status == 301 || resp.status == 302 || resp.status == 303 || resp.status == 307 || resp.status == 308;
+        std::string location = resp.header("Location");
+        bool follow = redirect && !location.empty() && hop < request.maxRedirects;
+        bool noBody = req.method == "HEAD" || resp.status == 204 || resp.status == 304 || (resp.status >= 100 && resp.status < 200);
+        std::string te = resp.header("Transfer-Encoding");
+        std::transform(te.begin(), te.end(), te.begin(), ::tolower);
+        std::string cl = resp.header("Content-Length");
+        std::string ce = resp.header("Content-Encoding");
+        std::transform(ce.begin(), ce.end(), ce.begin(), ::tolower);
+        bool decode = request.acceptCompressed && !noBody && !follow && (ce == "gzip" || ce == "x-gzip" || ce == "deflate");
+        if (decode) {
+            resp.headers.erase(std::remove_if(resp.headers.begin(), resp.headers.end(), [](const std::pair<std::string, std::string>& h) {
+                return iequals(h.first, "Content-Encoding") || iequals(h.first, "Content-Length");
+            }), resp.headers.end());
+        }
+        if (!follow && request.onHeaders) request.onHeaders(resp);
+
+        bool streaming = sink && resp.ok() && !follow;
+        std::function<bool(const char*, size_t)> deliver = [&](const char* data, size_t n) {
+            if (follow) return true; // redirect bodies are drained only to keep the socket
+            if (streaming) return sink(data, n);
+            resp.body.append(data, n);
+            return true;
+        };
+        std::unique_ptr<Inflater> inflater(decode ? new Inflater(ce == "deflate", deliver) : nullptr);
+        std::function<bool(const char*, size_t)> out = inflater
+            ? std::function<bool(const char*, size_t)>([&](const char* data, size_t n) { return inflater->feed(data, n); })
+            : deliver;
+        bool eof = false;
+        bool delimited = true;
+        bool okBody = true;
+        if (noBody) {
+            // nothing follows the headers
+        } else if (te.find("chunked") != std::string::npos) {
+            okBody = readChunked(*reader, out);
+        } else if (!cl.empty()) {
+            long length = std::strtol(cl.c_str(), nullptr, 10);
+            if (!streaming && !follow && length > 0) resp.body.reserve((size_t)length);
+            okBody = reader->readBody(length, out, eof) && !eof;
+        } else {
+            delimited = false;
+            if (!follow) okBody = reader->readBody(-1, out, eof);
+        }
+        if (okBody && reader->drained() && reusable(resp, statusLine, delimited)) release(std::move(conn));
+        if (inflater && !inflater->finished()) okBody = false;
+        reader.reset();
+        conn.reset();
+
+        if (follow) {
+            req.url = resolveUrl(req.url, location);
+            if (resp.status == 303) req.method = "GET";
+            continue;
+        }
+        if (!okBody) {
+            resp.error = TaskPool::cancelled() ? "cancelled" : remainingMs(deadline, unlimited) == 0 ? "timed out" : "body read failed or aborted";
+            resp.status = 0;
+        }
+        return resp;
+    }
+    resp.error = "too many redirects";
+    resp.status = 0;
+    return resp;
+}
+
+}
@@ -1,81 +1,147 @@
 #include "include/HttpUtils.h"
+#include "include/TaskPool.h"
+#include "include/SingleFlight.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace HttpUtils {
-    std::string fetchWebContent(const std::string& url) {
-        std::string result;
-        std::string command = "curl --globoff --cacert /etc/ssl/certs/ca-certificates.crt --max-time 15 -fsSL \"" + url + "\"";
-        FILE* pipe = popen(command.c_str(), "r");
-        if (pipe) {
-            char buffer[128];
-            while (!feof(pipe)) {
-                if (fgets(buffer, 128, pipe) != nullptr) result += buffer;
+    // Stream a successful response into outputPath via a .part file so readers never see half-written files
+    static bool downloadToPath(const std::string& url, const std::string& outputPath, int timeoutMs) {
+        std::string partPath = outputPath + ".part";
+        FILE* out = fopen(partPath.c_str(), "wb");
+        if (!out) return false;
+        HttpClient::Request req;
+        req.url = url;
+        req.timeoutMs = timeoutMs;
+        HttpClient::Response resp = HttpClient::perform(req, [out](const char* data, size_t len) {
+            return fwrite(data, 1, len, out) == len;
+        });
+        bool ok = fclose(out) == 0 && resp.ok();
+        if (ok) ok = rename(partPath.c_str(), outputPath.c_str()) == 0;
+        if (!ok) {
+            std::remove(partPath.c_str());
+            printf("[HttpUtils] Download failed (%d %s): %s\n", resp.status, resp.error.c_str(), url.c_str());
+        }
+        return ok;
+    }
+
+    // Concurrent callers for the same page url / image path share one transfer
+    static SingleFlight<std::string> pageFlights;
+    static SingleFlight<bool> imageFlights;
+
+    // HTML pages go through the on-disk cache: fresh copies skip the network, stale ones are
+    // revalidated with ETag/Last-Modified and still served if the site is unreachable.
+    // Runs against a mock server (base-url override) bypass the cache in both directions.
+    static std::string fetchPage(const std::string& url) {
+        bool useCache = HttpClient::baseUrlOverride().empty();
+        HttpCache::Entry cached;
+        bool haveCached = useCache && HttpCache::lookup(url, cached);
+        if (haveCached && cached.fresh) return std::move(cached.body);
+
+        HttpClient::Request req;
+        req.url = url;
+        req.timeoutMs = 15000;
+        req.acceptCompressed = true; // listing/detail HTML shrinks several times over gzip
+        if (haveCached && !cached.etag.empty()) req.headers.emplace_back("If-None-Match", cached.etag);
+        if (haveCached && !cached.lastModified.empty()) req.headers.emplace_back("If-Modified-Since", cached.lastModified);
+        HttpClient::Response resp = HttpClient::perform(req);
+        if (haveCached && resp.status == 304) {
+            HttpCache::touch(url);
+            return std::move(cached.body);
+        }
+        if (!resp.ok()) {
+            printf("[HttpUtils] GET failed (%d %s): %s\n", resp.status, resp.error.c_str(), url.c_str());
+            if (haveCached) {
+                printf("[HttpUtils] Serving stale cached copy of %s\n", url.c_str());
+                return std::move(cached.body);
             }
-            int status = pclose(pipe);
+            return "";
+        }
+        if (useCache && resp.header("Cache-Control").find("no-store") == std::string::npos && !resp.body.empty()) {
+            HttpCache::store(url, resp.body, resp.header("ETag"), resp.header("Last-Modified"));
         }
-        if (result.empty()) {
-            command = "wget --timeout=15 -q -O - \"" + url + "\"";
-            pipe = popen(command.c_str(), "r");
-            if (pipe) {
-                char buffer[128];
-                while (!feof(pipe)) {
-                    if (fgets(buffer, 128, pipe) != nullptr) result += buffer;
+        return std::move(resp.body);
+    }
+
+    std::string fetchWebContent(const std::string& url) {
+        return pageFlights.run(url, [&url] { return fetchPage(url); });
+    }
+
+    void fetchPagesInOrder(const std::function<std::string(int page)>& urlForPage, int maxPages, int window,
+                           const std::function<bool(int page, const std::string& html)>& onPage) {
+        struct Pages {
+            std::mutex mutex;
+            std::condition_variable ready;
+            std::map<int, std::string> queued;   // url of each page nobody has started yet
+            std::map<int, std::string> done;
+        };
+        auto pages = std::make_shared<Pages>();
+        // Fetch a page on the calling thread unless someone already took it
+        auto fetchIfQueued = [](const std::shared_ptr<Pages>& pages, int page) {
+            std::string url;
+            {
+                std::lock_guard<std::mutex> lock(pages->mutex);
+                auto it = pages->queued.find(page);
+                if (it == pages->queued.end()) return;
+                url = std::move(it->second);
+                pages->queued.erase(it);
+            }
+            std::string html = fetchWebContent(url);
+            std::lock_guard<std::mutex> lock(pages->mutex);
+            pages->done[page] = std::move(html);
+            pages->ready.notify_all();
+        };
+        // Page fetches are pool subtasks under a child of the caller's token, so cancelling the
+        // caller aborts them and stopping early drops the rest. The caller fetches a page itself
+        // when no worker has picked it up, and so never waits on a fetch that has no worker.
+        TaskPool::CancelToken batch = TaskPool::currentToken().child();
+        TaskPool::Priority priority = TaskPool::currentPriority();
+        int nextToStart = 1;
+        for (int page = 1; page <= maxPages; ++page) {
+            for (; nextToStart <= std::min(page + std::max(1, window) - 1, maxPages); ++nextToStart) {
+                int ahead = nextToStart;
+                {
+                    std::lock_guard<std::mutex> lock(pages->mutex);
+                    pages->queued[ahead] = urlForPage(ahead);
                 }
-                int status = pclose(pipe);
+                TaskPool::submit(priority, batch, [pages, fetchIfQueued, ahead]() { fetchIfQueued(pages, ahead); });
             }
+            fetchIfQueued(pages, page);
+            std::string html;
+            {
+                std::unique_lock<std::mutex> lock(pages->mutex);
+                while (!pages->done.count(page) && !TaskPool::cancelled()) {
+                    pages->ready.wait_for(lock, std::chrono::milliseconds(100));
+                }
+                if (!pages->done.count(page)) break;
+                html = std::move(pages->done[page]);
+                pages->done.erase(page);
+            }
+            if (TaskPool::cancelled() || !onPage(page, html)) break;
         }
-        return result;
+        batch.cancel();
     }
 
     bool downloadImage(const std::string& url, const std::string& outputPath) {
-        std::string command = "curl --globoff --cacert /etc/ssl/certs/ca-certificates.crt -fsSL -o \"" + outputPath + "\" \"" + url + "\"";
-        int ret = system(command.c_str());
-        if (ret != 0) {
-            command = "wget --timeout=60 -q -O \"" + outputPath + "\" \"" + url + "\"";
-            ret = system(command.c_str());
-        }
-        return ret == 0;
+        // Keyed on the file so two writers never race on the same .part
+        return imageFlights.run(outputPath, [&] { return downloadToPath(url, outputPath, 60000); });
     }
 
-    // Use downloadImage for downloadFile
+    // ROM archives can be large; only the connect phase is time limited
     bool downloadFile(const std::string& url, const std::string& outputPath) {
-        return downloadImage(url, outputPath);
+        return downloadToPath(url, outputPath, 0);
     }
 
     bool hasInternet() {
-        std::string url = "https://www.google.com/generate_204";
-        std::string command = "curl --globoff --cacert /etc/ssl/certs/ca-certificates.crt --max-time 15 -fsSL \"" + url + "\"";
-    // Reduced logging noise
-        FILE* pipe = popen(command.c_str(), "r");
-        std::string data;
-        int curl_status = -1;
-        if (pipe) {
-            char buffer[128];
-            while (!feof(pipe)) {
-                if (fgets(buffer, 128, pipe) != nullptr) data += buffer;
-            }
-            curl_status = pclose(pipe);
-            // Debug suppressed
-        }
-    // Suppress data size log
-        if (curl_status == 0) {
-            // Success, even if data is empty (204 response)
-            return true;
-        }
-        // Fallback to wget
-        std::string fallback = "wget --timeout=15 -q -O - \"" + url + "\"";
-    // Suppress fallback log
-        pipe = popen(fallback.c_str(), "r");
-        int wget_status = -1;
-        data.clear();
-        if (pipe) {
-            char buffer[128];
-            while (!feof(pipe)) {
-                if (fgets(buffer, 128, pipe) != nullptr) data += buffer;
-            }
-            wget_status = pclose(pipe);
-            // Suppress wget exit status log
-        }
-    // Suppress data size after wget log
-        return wget_status == 0;
+        HttpClient::Request req;
+        req.url = "https://www.google.com/generate_204";
+        req.timeoutMs = 15000;
+        // Success, even if data is empty (204 response)
+        return HttpClient::perform(req).ok();
     }
-}
\ No newline at end of file
+}
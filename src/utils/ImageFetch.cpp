@@ -0,0 +1,341 @@
+#include "include/ImageFetch.h"
+#include "include/HttpUtils.h"
+#include "include/ImageUtils.h"
+#include "include/MpscQueue.h"
+#include "include/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+namespace ImageFetch {
+namespace {
+
+const int kWorkers = 6;
+const size_t kMaxQueuedPerOwner = 96;
+// Jobs further than this many viewports away from the visible range are dropped
+const int kKeepViewports = 3;
+
+struct Job {
+    int owner;
+    unsigned generation;
+    int index;
+    std::string url;
+    std::string path;
+    int coverW;
+    int coverH;
+    bool warm = false;   // only fills the disk/thumbnail cache: no result, not tracked in known
+};
+
+struct Owner {
+    unsigned generation = 0;
+    int first = 0;
+    int last = 0;
+    int direction = 0;
+    std::set<int> known;             // queued, in flight or failed
+};
+
+// Finished jobs travel to the render thread through a lock-free queue, so polling for uploads
+// never waits on fetchMutex while workers pick jobs
+struct Finished {
+    int owner = 0;
+    unsigned generation = 0;
+    Result result;
+};
+
+// Render-thread side of an owner: results routed out of the shared queue, and the generation
+// they must match (mirrors Owner::generation, both bumped by cancel())
+struct Inbox {
+    unsigned generation = 0;
+    std::deque<Result> results;
+};
+
+std::mutex fetchMutex;
+std::condition_variable wake;
+std::list<Job> queue;
+std::map<int, Owner> owners;
+std::vector<std::thread> workers;
+int nextOwner = 1;
+bool stopping = false;
+std::atomic<Uint32> wakeEvent{(Uint32)-1};
+Stats counters;
+
+MpscQueue<Finished> finished;
+std::atomic<bool> wakePending{false};  // a wake-up event is out and no poll has answered it yet
+std::map<int, Inbox> inboxes;          // render thread only
+
+// Distance of index from the owner's viewport in items; tiles behind the scroll direction count double
+int distanceLocked(const Owner& o, int index) {
+    if (index >= o.first && index <= o.last) return 0;
+    if (index < o.first) return (o.first - index) * (o.direction > 0 ? 2 : 1);
+    return (index - o.last) * (o.direction < 0 ? 2 : 1);
+}
+
+int keepDistanceLocked(const Owner& o) {
+    int span = std::max(1, o.last - o.first + 1);
+    return span * kKeepViewports;
+}
+
+void freeResults(Inbox& inbox) {
+    for (auto& r : inbox.results) if (r.surface) SDL_FreeSurface(r.surface);
+    inbox.results.clear();
+}
+
+// Render thread: move finished jobs into their owners' inboxes, dropping stale ones
+void routeFinished() {
+    wakePending = false;
+    Finished f;
+    while (finished.pop(f)) {
+        auto inbox = inboxes.find(f.owner);
+        if (inbox == inboxes.end() || inbox->second.generation != f.generation) {
+            if (f.result.surface) SDL_FreeSurface(f.result.surface);
+        } else {
+            inbox->second.results.push_back(std::move(f.result));
+        }
+        f = Finished();
+    }
+}
+
+bool fileExists(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && st.st_size > 0;
+}
+
+// Downscaled copy next to the cached download: cache/images/<hash>_<w>x<h>.thumb
+std::string thumbnailPath(const Job& job) {
+    size_t dot = job.path.find_last_of('.');
+    size_t slash = job.path.find_last_of('/');
+    std::string stem = (dot != std::string::npos && (slash == std::string::npos || dot > slash)) ? job.path.substr(0, dot) : job.path;
+    return stem + "_" + std::to_string(job.coverW) + "x" + std::to_string(job.coverH) + ".thumb";
+}
+
+// Thumbnail if present, else download if needed, decode, scale and write the thumbnail.
+// Runs without the lock held.
+SDL_Surface* fetchAndDecode(const Job& job) {
+    Profiler::Scope scope("ImageFetch::fetchAndDecode");
+    bool remote = job.url.compare(0, 4, "http") == 0;
+    bool thumbnailed = remote && job.coverW > 0 && job.coverH > 0;
+    std::string thumbPath = thumbnailed ? thumbnailPath(job) : std::string();
+    if (thumbnailed) {
+        if (SDL_Surface* thumb = ImageUtils::loadThumbnail(thumbPath)) return thumb;
+    }
+    if (remote && !fileExists(job.path) && !HttpUtils::downloadImage(job.url, job.path)) return nullptr;
+    SDL_Surface* surface = ImageUtils::coverFit(ImageUtils::loadRgba(job.path), job.coverW, job.coverH);
+    // A corrupt download would otherwise be served from cache forever
+    if (!surface && remote) std::remove(job.path.c_str());
+    if (surface && thumbnailed) ImageUtils::saveThumbnail(thumbPath, surface);
+    return surface;
+}
+
+void dropJobLocked(std::list<Job>::iterator it) {
+    auto owner = owners.find(it->owner);
+    if (owner != owners.end() && !it->warm) owner->second.known.erase(it->index);
+    queue.erase(it);
+    counters.dropped++;
+}
+
+// Nearest job across all owners
+bool takeLocked(Job& out) {
+    auto best = queue.end();
+    int bestDistance = 0;
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+        auto owner = owners.find(it->owner);
+        int d = owner == owners.end() ? 0 : distanceLocked(owner->second, it->index);
+        if (best == queue.end() || d < bestDistance) {
+            best = it;
+            bestDistance = d;
+        }
+    }
+    if (best == queue.end()) return false;
+    out = std::move(*best);
+    queue.erase(best);
+    return true;
+}
+
+void workerLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(fetchMutex);
+            wake.wait(lock, [] { return stopping || !queue.empty(); });
+            if (stopping) return;
+            if (!takeLocked(job)) continue;
+        }
+        SDL_Surface* surface = fetchAndDecode(job);
+        bool ok = surface != nullptr;
+        if (job.warm) {
+            if (surface) SDL_FreeSurface(surface);
+            std::lock_guard<std::mutex> lock(fetchMutex);
+            ok ? counters.completed++ : counters.failed++;
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(fetchMutex);
+            ok ? counters.completed++ : counters.failed++;
+            auto owner = owners.find(job.owner);
+            if (owner == owners.end() || owner->second.generation != job.generation) {
+                if (surface) SDL_FreeSurface(surface);
+                continue;
+            }
+            // Failed indices stay in known so they are not retried every frame
+            if (ok) owner->second.known.erase(job.index);
+        }
+        Finished f;
+        f.owner = job.owner;
+        f.generation = job.generation;
+        f.result.index = job.index;
+        f.result.url = std::move(job.url);
+        f.result.path = std::move(job.path);
+        f.result.ok = ok;
+        f.result.surface = surface;
+        finished.push(std::move(f));
+        // One wake-up per batch: the owner keeps drawing until its results are drained
+        Uint32 type = wakeEvent;
+        if (type != (Uint32)-1 && !wakePending.exchange(true)) {
+            SDL_Event event; SDL_zero(event);
+            event.type = type;
+            SDL_PushEvent(&event);
+        }
+    }
+}
+
+void startLocked() {
+    if (!workers.empty() || stopping) return;
+    wakeEvent = SDL_RegisterEvents(1);
+    for (int i = 0; i < kWorkers; ++i) workers.emplace_back(workerLoop);
+}
+
+void enqueue(int owner, int index, const std::string& url, const std::string& path, int coverW, int coverH, bool warm) {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    auto it = owners.find(owner);
+    if (it == owners.end() || stopping) return;
+    Owner& o = it->second;
+    if (!warm && !o.known.insert(index).second) return;
+    counters.requested++;
+    queue.push_back(Job{owner, o.generation, index, url, path, coverW, coverH, warm});
+    // Bounded per owner: shed the job furthest from the viewport
+    size_t mine = 0;
+    auto furthest = queue.end();
+    int furthestDistance = -1;
+    for (auto q = queue.begin(); q != queue.end(); ++q) {
+        if (q->owner != owner) continue;
+        ++mine;
+        int d = distanceLocked(o, q->index);
+        if (d > furthestDistance) { furthest = q; furthestDistance = d; }
+    }
+    if (mine > kMaxQueuedPerOwner && furthest != queue.end()) dropJobLocked(furthest);
+    wake.notify_one();
+}
+
+} // namespace
+
+int registerOwner() {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    startLocked();
+    int id = nextOwner++;
+    owners[id];
+    inboxes[id];
+    return id;
+}
+
+void unregisterOwner(int owner) {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    for (auto it = queue.begin(); it != queue.end();) {
+        if (it->owner == owner) { it = queue.erase(it); counters.dropped++; }
+        else ++it;
+    }
+    owners.erase(owner);
+    auto inbox = inboxes.find(owner);
+    if (inbox == inboxes.end()) return;
+    freeResults(inbox->second);
+    inboxes.erase(inbox);
+}
+
+void request(int owner, int index, const std::string& url, const std::string& path, int coverW, int coverH) {
+    enqueue(owner, index, url, path, coverW, coverH, false);
+}
+
+void warm(int owner, int index, const std::string& url, const std::string& path, int coverW, int coverH) {
+    enqueue(owner, index, url, path, coverW, coverH, true);
+}
+
+void setViewport(int owner, int first, int last, int direction) {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    auto it = owners.find(owner);
+    if (it == owners.end()) return;
+    Owner& o = it->second;
+    if (o.first == first && o.last == last && (direction == 0 || o.direction == direction)) return;
+    o.first = first;
+    o.last = last;
+    if (direction != 0) o.direction = direction;
+    int keep = keepDistanceLocked(o);
+    for (auto q = queue.begin(); q != queue.end();) {
+        auto next = std::next(q);
+        if (q->owner == owner && distanceLocked(o, q->index) > keep) dropJobLocked(q);
+        q = next;
+    }
+}
+
+void cancel(int owner) {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    auto it = owners.find(owner);
+    if (it == owners.end()) return;
+    for (auto q = queue.begin(); q != queue.end();) {
+        if (q->owner == owner) { q = queue.erase(q); counters.dropped++; }
+        else ++q;
+    }
+    it->second.generation++;
+    it->second.known.clear();
+    Inbox& inbox = inboxes[owner];
+    inbox.generation = it->second.generation;
+    freeResults(inbox);
+}
+
+bool poll(int owner, Result& out) {
+    routeFinished();
+    auto it = inboxes.find(owner);
+    if (it == inboxes.end() || it->second.results.empty()) return false;
+    out = std::move(it->second.results.front());
+    it->second.results.pop_front();
+    return true;
+}
+
+bool hasResults(int owner) {
+    routeFinished();
+    auto it = inboxes.find(owner);
+    return it != inboxes.end() && !it->second.results.empty();
+}
+
+Uint32 resultEvent() {
+    return wakeEvent;
+}
+
+Stats stats() {
+    std::lock_guard<std::mutex> lock(fetchMutex);
+    return counters;
+}
+
+void shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(fetchMutex);
+        stopping = true;
+        queue.clear();
+    }
+    wake.notify_all();
+    for (auto& t : workers) if (t.joinable()) t.join();
+    workers.clear();
+    routeFinished();
+    for (auto& inbox : inboxes) freeResults(inbox.second);
+}
+
+}
@@ -0,0 +1,192 @@
+#include "include/ImageUtils.h"
+
+#include <SDL2/SDL_image.h>
+#include <zlib.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace ImageUtils {
+namespace {
+
+// Thumbnail file: header followed by the zlib-compressed, tightly packed pixel rows
+const char kThumbMagic[4] = {'P', 'L', 'T', 'H'};
+const Uint8 kThumbVersion = 1;
+enum ThumbFormat : Uint8 { ThumbRGBA32 = 0, ThumbRGB565 = 1 };
+
+struct ThumbHeader {
+    char magic[4];
+    Uint8 version;
+    Uint8 format;
+    Uint16 width;
+    Uint16 height;
+    Uint16 reserved;
+    Uint32 compressedSize;
+};
+
+// Area-average srcRect of an RGBA32 surface into a new dw x dh RGBA32 surface
+SDL_Surface* resample(SDL_Surface* src, const SDL_Rect& srcRect, int dw, int dh) {
+    SDL_Surface* dst = SDL_CreateRGBSurfaceWithFormat(0, dw, dh, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!dst) return nullptr;
+
+    // Source span [xs[i], xs[i + 1]) feeds destination column i; same for rows
+    std::vector<int> xs(dw + 1), ys(dh + 1);
+    for (int i = 0; i <= dw; ++i) xs[i] = srcRect.x + (int)((long long)i * srcRect.w / dw);
+    for (int i = 0; i <= dh; ++i) ys[i] = srcRect.y + (int)((long long)i * srcRect.h / dh);
+
+    SDL_LockSurface(src);
+    SDL_LockSurface(dst);
+    const Uint8* in = (const Uint8*)src->pixels;
+    Uint8* out = (Uint8*)dst->pixels;
+    std::vector<Uint32> sums((size_t)dw * 4);
+    for (int dy = 0; dy < dh; ++dy) {
+        std::fill(sums.begin(), sums.end(), 0);
+        int y0 = ys[dy], y1 = std::max(ys[dy + 1], y0 + 1);
+        for (int sy = y0; sy < y1; ++sy) {
+            const Uint8* row = in + (size_t)sy * src->pitch;
+            for (int dx = 0; dx < dw; ++dx) {
+                int x0 = xs[dx], x1 = std::max(xs[dx + 1], x0 + 1);
+                Uint32* acc = &sums[(size_t)dx * 4];
+                for (const Uint8* p = row + x0 * 4; p < row + x1 * 4; p += 4) {
+                    acc[0] += p[0]; acc[1] += p[1]; acc[2] += p[2]; acc[3] += p[3];
+                }
+            }
+        }
+        Uint8* dstRow = out + (size_t)dy * dst->pitch;
+        for (int dx = 0; dx < dw; ++dx) {
+            Uint32 count = (Uint32)(std::max(xs[dx + 1], xs[dx] + 1) - xs[dx]) * (Uint32)(y1 - y0);
+            const Uint32* acc = &sums[(size_t)dx * 4];
+            for (int c = 0; c < 4; ++c) dstRow[dx * 4 + c] = (Uint8)((acc[c] + count / 2) / count);
+        }
+    }
+    SDL_UnlockSurface(dst);
+    SDL_UnlockSurface(src);
+    return dst;
+}
+
+bool isOpaque(const SDL_Surface* s) {
+    for (int y = 0; y < s->h; ++y) {
+        const Uint8* row = (const Uint8*)s->pixels + (size_t)y * s->pitch;
+        for (int x = 0; x < s->w; ++x) if (row[x * 4 + 3] != 255) return false;
+    }
+    return true;
+}
+
+SDL_Surface* toRgb565(const SDL_Surface* s) {
+    SDL_Surface* dst = SDL_CreateRGBSurfaceWithFormat(0, s->w, s->h, 16, SDL_PIXELFORMAT_RGB565);
+    if (!dst) return nullptr;
+    for (int y = 0; y < s->h; ++y) {
+        const Uint8* in = (const Uint8*)s->pixels + (size_t)y * s->pitch;
+        Uint16* out = (Uint16*)((Uint8*)dst->pixels + (size_t)y * dst->pitch);
+        for (int x = 0; x < s->w; ++x, in += 4)
+            out[x] = (Uint16)(((in[0] >> 3) << 11) | ((in[1] >> 2) << 5) | (in[2] >> 3));
+    }
+    return dst;
+}
+
+} // namespace
+
+SDL_Surface* loadRgba(const std::string& path) {
+    SDL_Surface* decoded = nullptr;
+    if (path.size() > 5 && path.compare(path.size() - 5, 5, ".webp") == 0) {
+        SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "rb");
+        if (rw) {
+            decoded = IMG_LoadWEBP_RW(rw);
+            SDL_RWclose(rw);
+        }
+    } else {
+        decoded = IMG_Load(path.c_str());
+    }
+    if (!decoded) return nullptr;
+    if (decoded->format->format == SDL_PIXELFORMAT_RGBA32) return decoded;
+    SDL_Surface* rgba = SDL_ConvertSurfaceFormat(decoded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(decoded);
+    return rgba;
+}
+
+SDL_Surface* coverFit(SDL_Surface* src, int boxW, int boxH) {
+    if (!src || boxW <= 0 || boxH <= 0 || src->w <= 0 || src->h <= 0) return src;
+    // Centered crop with the box's aspect ratio (same crop ListScreen used to do per frame)
+    SDL_Rect crop = {0, 0, src->w, src->h};
+    if ((long long)src->w * boxH > (long long)boxW * src->h) {
+        crop.w = std::max(1, (int)((long long)src->h * boxW / boxH));
+        crop.x = (src->w - crop.w) / 2;
+    } else {
+        crop.h = std::max(1, (int)((long long)src->w * boxH / boxW));
+        crop.y = (src->h - crop.h) / 2;
+    }
+    // Never upscale: small art keeps its resolution and the GPU stretches it
+    int dw = std::min(boxW, crop.w);
+    int dh = std::min(boxH, crop.h);
+    if (crop.x == 0 && crop.y == 0 && dw == src->w && dh == src->h) return src;
+    SDL_Surface* dst = resample(src, crop, dw, dh);
+    if (!dst) return src;
+    SDL_FreeSurface(src);
+    return dst;
+}
+
+bool saveThumbnail(const std::string& path, SDL_Surface* rgba) {
+    if (!rgba || rgba->format->format != SDL_PIXELFORMAT_RGBA32 || rgba->w > 0xFFFF || rgba->h > 0xFFFF) return false;
+    SDL_Surface* packed = isOpaque(rgba) ? toRgb565(rgba) : rgba;
+    if (!packed) return false;
+    int bpp = packed == rgba ? 4 : 2;
+    std::vector<Uint8> raw((size_t)rgba->w * rgba->h * bpp);
+    for (int y = 0; y < rgba->h; ++y)
+        memcpy(&raw[(size_t)y * rgba->w * bpp], (const Uint8*)packed->pixels + (size_t)y * packed->pitch, (size_t)rgba->w * bpp);
+    if (packed != rgba) SDL_FreeSurface(packed);
+
+    uLongf compressedSize = compressBound(raw.size());
+    std::vector<Uint8> compressed(compressedSize);
+    // Level 1: thumbnails are written once per image, but read back on every scroll
+    if (compress2(compressed.data(), &compressedSize, raw.data(), raw.size(), 1) != Z_OK) return false;
+
+    ThumbHeader header;
+    memcpy(header.magic, kThumbMagic, sizeof(header.magic));
+    header.version = kThumbVersion;
+    header.format = bpp == 4 ? ThumbRGBA32 : ThumbRGB565;
+    header.width = (Uint16)rgba->w;
+    header.height = (Uint16)rgba->h;
+    header.reserved = 0;
+    header.compressedSize = (Uint32)compressedSize;
+
+    // Write to a temp file and rename so a concurrent reader never sees half a thumbnail
+    std::string partPath = path + ".part";
+    FILE* f = fopen(partPath.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(compressed.data(), 1, compressedSize, f) == compressedSize;
+    ok = fclose(f) == 0 && ok;
+    if (ok) ok = rename(partPath.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(partPath.c_str());
+    return ok;
+}
+
+SDL_Surface* loadThumbnail(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return nullptr;
+    ThumbHeader header;
+    bool ok = fread(&header, sizeof(header), 1, f) == 1 && memcmp(header.magic, kThumbMagic, 4) == 0 &&
+              header.version == kThumbVersion && header.format <= ThumbRGB565 && header.width > 0 && header.height > 0;
+    std::vector<Uint8> compressed;
+    if (ok) {
+        compressed.resize(header.compressedSize);
+        ok = fread(compressed.data(), 1, compressed.size(), f) == compressed.size();
+    }
+    fclose(f);
+    if (!ok) return nullptr;
+
+    int bpp = header.format == ThumbRGBA32 ? 4 : 2;
+    std::vector<Uint8> raw((size_t)header.width * header.height * bpp);
+    uLongf rawSize = raw.size();
+    if (uncompress(raw.data(), &rawSize, compressed.data(), compressed.size()) != Z_OK || rawSize != raw.size()) return nullptr;
+
+    Uint32 format = header.format == ThumbRGBA32 ? SDL_PIXELFORMAT_RGBA32 : SDL_PIXELFORMAT_RGB565;
+    SDL_Surface* s = SDL_CreateRGBSurfaceWithFormat(0, header.width, header.height, bpp * 8, format);
+    if (!s) return nullptr;
+    for (int y = 0; y < s->h; ++y)
+        memcpy((Uint8*)s->pixels + (size_t)y * s->pitch, &raw[(size_t)y * s->w * bpp], (size_t)s->w * bpp);
+    return s;
+}
+
+}
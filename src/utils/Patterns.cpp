@@ -0,0 +1,63 @@
+#include "include/Patterns.h"
+
+#include <chrono>
+#include <cstdio>
+
+namespace Patterns {
+
+const std::regex& parenthesized() {
+    static const std::regex re(R"(\s*\([^)]*\))");
+    return re;
+}
+
+const std::regex& bracketed() {
+    static const std::regex re(R"(\s*\[[^\]]*\])");
+    return re;
+}
+
+const std::regex& romIsoNoise() {
+    static const std::regex re(R"(ROMs?|ISO|&amp;|&|\s{2,})", std::regex::icase);
+    return re;
+}
+
+const std::regex& outerWhitespace() {
+    static const std::regex re(R"(^\s+|\s+$)");
+    return re;
+}
+
+const std::regex& spaceRuns() {
+    static const std::regex re(R"(\s{2,})");
+    return re;
+}
+
+const std::regex& pageSuffix() {
+    static const std::regex re(R"(/page/\d+/?)", std::regex::icase);
+    return re;
+}
+
+const std::regex& romsConsolePath() {
+    static const std::regex re(R"(/roms/([^/?]+))");
+    return re;
+}
+
+const std::regex& currentPageParam() {
+    static const std::regex re(R"(&currentpage=\d+)");
+    return re;
+}
+
+const std::regex& unsafeFileNameChar() {
+    static const std::regex re(R"([^A-Za-z0-9_\-\.])");
+    return re;
+}
+
+void precompile() {
+    auto start = std::chrono::steady_clock::now();
+    const std::regex* all[] = {
+        &parenthesized(), &bracketed(), &romIsoNoise(), &outerWhitespace(), &spaceRuns(),
+        &pageSuffix(), &romsConsolePath(), &currentPageParam(), &unsafeFileNameChar(),
+    };
+    long us = (long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("[Patterns] Compiled %zu patterns in %ld us\n", sizeof(all) / sizeof(all[0]), us);
+}
+
+}
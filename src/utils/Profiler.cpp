@@ -0,0 +1,225 @@
+#include "include/Profiler.h"
+#include "include/UiUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Profiler {
+namespace {
+
+// Percentiles cover the last ~4 s of continuous rendering
+const size_t kFrameWindow = 240;
+// Overlay numbers refresh at this rate so they stay readable (and the text cache stays small)
+const long long kOverlayRefreshUs = 500 * 1000;
+const size_t kMaxTraceEvents = 500000;
+const size_t kOverlayScopes = 8;
+
+struct Aggregate {
+    unsigned long calls = 0;
+    long long totalUs = 0;
+};
+
+struct TraceEvent {
+    const char* name;
+    long long ts;
+    long long dur;
+    int tid;
+};
+
+std::atomic<bool> active{false};   // overlay visible or tracing
+bool showOverlay = false;
+bool tracing = false;
+std::string tracePath;
+
+std::mutex profileMutex;
+std::map<const char*, Aggregate> scopes;   // since the last overlay refresh
+std::map<const char*, size_t> texturePools;
+std::vector<TraceEvent> trace;
+bool traceFull = false;
+std::vector<float> frameMs;                // ring buffer of kFrameWindow frames
+size_t frameCursor = 0;
+
+// Render-thread state
+long long frameStartUs = -1;
+unsigned long windowFrames = 0;
+unsigned long windowDrawCalls = 0;
+long long lastRefreshUs = 0;
+std::vector<std::string> overlayLines;
+
+long long nowUs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+int threadId() {
+    static std::atomic<int> nextId{1};
+    thread_local int id = nextId++;
+    return id;
+}
+
+void updateActive() { active = showOverlay || tracing; }
+
+void recordLocked(const char* name, long long start, long long dur) {
+    Aggregate& a = scopes[name];
+    a.calls++;
+    a.totalUs += dur;
+    if (!tracing || traceFull) return;
+    if (trace.size() >= kMaxTraceEvents) {
+        traceFull = true;
+        printf("[Profiler] trace buffer full (%zu events), recording stopped\n", trace.size());
+        return;
+    }
+    trace.push_back(TraceEvent{name, start, dur, threadId()});
+}
+
+float percentile(std::vector<float> sorted, float p) {
+    if (sorted.empty()) return 0.0f;
+    size_t i = std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5f));
+    std::nth_element(sorted.begin(), sorted.begin() + i, sorted.end());
+    return sorted[i];
+}
+
+void refreshOverlayLocked(long long now) {
+    char line[160];
+    overlayLines.clear();
+    float p50 = percentile(frameMs, 0.50f), p95 = percentile(frameMs, 0.95f), p99 = percentile(frameMs, 0.99f);
+    snprintf(line, sizeof(line), "frame ms  p50 %.1f  p95 %.1f  p99 %.1f  (%zu frames)", p50, p95, p99, frameMs.size());
+    overlayLines.push_back(line);
+    unsigned long frames = std::max(1UL, windowFrames);
+    size_t textureBytes = 0;
+    for (auto& pool : texturePools) textureBytes += pool.second;
+    snprintf(line, sizeof(line), "draw calls %lu/frame  textures %.1f MB", windowDrawCalls / frames, textureBytes / (1024.0 * 1024.0));
+    overlayLines.push_back(line);
+
+    // Most expensive scopes by time per frame over the refresh window
+    std::vector<std::pair<const char*, Aggregate>> sorted(scopes.begin(), scopes.end());
+    std::sort(sorted.begin(), sorted.end(), [](const std::pair<const char*, Aggregate>& a, const std::pair<const char*, Aggregate>& b) {
+        return a.second.totalUs > b.second.totalUs;
+    });
+    for (size_t i = 0; i < sorted.size() && i < kOverlayScopes; ++i) {
+        snprintf(line, sizeof(line), "%6.2f ms %6.1f x  %s", sorted[i].second.totalUs / 1000.0 / frames,
+                 (double)sorted[i].second.calls / frames, sorted[i].first);
+        overlayLines.push_back(line);
+    }
+    scopes.clear();
+    windowFrames = 0;
+    windowDrawCalls = 0;
+    lastRefreshUs = now;
+}
+
+} // namespace
+
+void init() {
+    const char* profile = getenv("PLUNDER_PROFILE");
+    const char* tracePathEnv = getenv("PLUNDER_TRACE");
+    showOverlay = profile && *profile && *profile != '0';
+    if (tracePathEnv && *tracePathEnv) {
+        tracing = true;
+        tracePath = tracePathEnv;
+        trace.reserve(64 * 1024);
+        printf("[Profiler] tracing to %s\n", tracePath.c_str());
+    }
+    updateActive();
+}
+
+bool overlayVisible() { return showOverlay; }
+
+void toggleOverlay() {
+    std::lock_guard<std::mutex> lock(profileMutex);
+    showOverlay = !showOverlay;
+    scopes.clear();
+    frameMs.clear();
+    frameCursor = 0;
+    windowFrames = 0;
+    windowDrawCalls = 0;
+    overlayLines.clear();
+    updateActive();
+}
+
+Scope::Scope(const char* name) : name(name), startUs(active.load(std::memory_order_relaxed) ? nowUs() : -1) {}
+
+Scope::~Scope() {
+    if (startUs < 0) return;
+    long long dur = nowUs() - startUs;
+    std::lock_guard<std::mutex> lock(profileMutex);
+    recordLocked(name, startUs, dur);
+}
+
+void beginFrame() {
+    frameStartUs = active.load(std::memory_order_relaxed) ? nowUs() : -1;
+}
+
+void endFrame() {
+    if (frameStartUs < 0) return;
+    long long now = nowUs();
+    long long dur = now - frameStartUs;
+    std::lock_guard<std::mutex> lock(profileMutex);
+    if (tracing && !traceFull) trace.push_back(TraceEvent{"frame", frameStartUs, dur, threadId()});
+    float ms = dur / 1000.0f;
+    if (frameMs.size() < kFrameWindow) frameMs.push_back(ms);
+    else frameMs[frameCursor] = ms;
+    frameCursor = (frameCursor + 1) % kFrameWindow;
+    windowFrames++;
+    if (showOverlay && now - lastRefreshUs >= kOverlayRefreshUs) refreshOverlayLocked(now);
+    frameStartUs = -1;
+}
+
+void countDrawCalls(int n) {
+    if (active.load(std::memory_order_relaxed)) windowDrawCalls += n;
+}
+
+void setTextureBytes(const char* pool, size_t bytes) {
+    // Kept while inactive too, so the overlay is right as soon as it is turned on
+    std::lock_guard<std::mutex> lock(profileMutex);
+    texturePools[pool] = bytes;
+}
+
+void drawOverlay(SDL_Renderer* renderer, TTF_Font* font) {
+    if (!showOverlay || !font) return;
+    std::vector<std::string> lines;
+    {
+        std::lock_guard<std::mutex> lock(profileMutex);
+        lines = overlayLines;
+    }
+    if (lines.empty()) lines.push_back("profiling...");
+    const float scale = 0.8f;
+    int lineH = (int)(TTF_FontLineSkip(font) * scale);
+    SDL_Rect box = {8, 8, 560, (int)lines.size() * lineH + 12};
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &box);
+    for (size_t i = 0; i < lines.size(); ++i) {
+        UiUtils::RenderText(renderer, font, lines[i], box.x + 8, box.y + 6 + (int)i * lineH, UiUtils::Color(i == 0 ? 255 : 200, 255, i == 0 ? 120 : 200), scale);
+    }
+}
+
+void shutdown() {
+    std::lock_guard<std::mutex> lock(profileMutex);
+    if (!tracing) return;
+    tracing = false;
+    updateActive();
+    FILE* f = fopen(tracePath.c_str(), "w");
+    if (!f) {
+        printf("[Profiler] could not write %s\n", tracePath.c_str());
+        return;
+    }
+    // Complete ("X") events; names are string literals, so no escaping is needed
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+    for (size_t i = 0; i < trace.size(); ++i) {
+        const TraceEvent& e = trace[i];
+        fprintf(f, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld,\"dur\":%lld}%s\n",
+                e.name, e.tid, e.ts, e.dur, i + 1 < trace.size() ? "," : "");
+    }
+    fputs("]}\n", f);
+    fclose(f);
+    printf("[Profiler] wrote %zu trace events to %s\n", trace.size(), tracePath.c_str());
+    trace.clear();
+}
+
+}
@@ -0,0 +1,54 @@
+#include "include/QuadBatch.h"
+#include "include/Profiler.h"
+
+void QuadBatch::add(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst, SDL_Color color) {
+    if (!texture) return;
+    Batch* batch = nullptr;
+    for (auto& b : batches) if (b.texture == texture) { batch = &b; break; }
+    if (!batch) {
+        int w = 1, h = 1;
+        SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+        batches.push_back(Batch{texture, 1.0f / w, 1.0f / h, {}, {}, {}, {}, {}});
+        batch = &batches.back();
+    }
+    quads++;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    float u0 = src.x * batch->invW, v0 = src.y * batch->invH;
+    float u1 = (src.x + src.w) * batch->invW, v1 = (src.y + src.h) * batch->invH;
+    float x0 = (float)dst.x, y0 = (float)dst.y, x1 = (float)(dst.x + dst.w), y1 = (float)(dst.y + dst.h);
+    int base = (int)batch->vertices.size();
+    batch->vertices.push_back(SDL_Vertex{{x0, y0}, color, {u0, v0}});
+    batch->vertices.push_back(SDL_Vertex{{x1, y0}, color, {u1, v0}});
+    batch->vertices.push_back(SDL_Vertex{{x1, y1}, color, {u1, v1}});
+    batch->vertices.push_back(SDL_Vertex{{x0, y1}, color, {u0, v1}});
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int i : quad) batch->indices.push_back(base + i);
+#else
+    batch->srcRects.push_back(src);
+    batch->dstRects.push_back(dst);
+    batch->colors.push_back(color);
+#endif
+}
+
+int QuadBatch::flush(SDL_Renderer* renderer) {
+    int drawCalls = 0;
+    for (auto& b : batches) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        SDL_RenderGeometry(renderer, b.texture, b.vertices.data(), (int)b.vertices.size(), b.indices.data(), (int)b.indices.size());
+        drawCalls++;
+#else
+        for (size_t i = 0; i < b.dstRects.size(); ++i) {
+            SDL_SetTextureColorMod(b.texture, b.colors[i].r, b.colors[i].g, b.colors[i].b);
+            SDL_SetTextureAlphaMod(b.texture, b.colors[i].a);
+            SDL_RenderCopy(renderer, b.texture, &b.srcRects[i], &b.dstRects[i]);
+            drawCalls++;
+        }
+        SDL_SetTextureColorMod(b.texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(b.texture, 255);
+#endif
+    }
+    batches.clear();
+    quads = 0;
+    Profiler::countDrawCalls(drawCalls);
+    return drawCalls;
+}
@@ -0,0 +1,96 @@
+#include "include/Sprites.h"
+#include "include/Profiler.h"
+
+#include <map>
+#include <utility>
+
+namespace Sprites {
+namespace {
+
+enum class Shape { CornerDiscs, CornerMask, Disc };
+
+std::map<std::pair<Shape, int>, SDL_Texture*> textures;
+
+// Alpha coverage of pixel (x, y) in the sprite for shape and radius r
+bool covered(Shape shape, int r, int x, int y) {
+    if (shape == Shape::Disc) {
+        int dx = x - r, dy = y - r;
+        return dx * dx + dy * dy <= r * r;
+    }
+    // Corner sprites are 2r x 2r: one r x r quadrant per rect corner, (dx, dy) from that corner
+    int dx = x < r ? x : 2 * r - 1 - x;
+    int dy = y < r ? y : 2 * r - 1 - y;
+    int d = dx * dx + dy * dy;
+    return shape == Shape::CornerDiscs ? d < r * r : d > r * r;
+}
+
+SDL_Texture* sprite(SDL_Renderer* renderer, Shape shape, int r) {
+    auto key = std::make_pair(shape, r);
+    auto it = textures.find(key);
+    if (it != textures.end()) return it->second;
+    int size = shape == Shape::Disc ? 2 * r + 1 : 2 * r;
+    SDL_Texture* texture = nullptr;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_RGBA32);
+    if (surface) {
+        for (int y = 0; y < size; ++y) {
+            Uint8* row = (Uint8*)surface->pixels + (size_t)y * surface->pitch;
+            for (int x = 0; x < size; ++x) {
+                row[x * 4 + 0] = row[x * 4 + 1] = row[x * 4 + 2] = 255;
+                row[x * 4 + 3] = covered(shape, r, x, y) ? 255 : 0;
+            }
+        }
+        texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_FreeSurface(surface);
+    }
+    if (texture) SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    textures[key] = texture;
+    return texture;
+}
+
+void tint(SDL_Texture* texture, SDL_Color color) {
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+}
+
+void drawCorners(SDL_Renderer* renderer, Shape shape, const SDL_Rect& rect, int r, SDL_Color color) {
+    if (r <= 0) return;
+    SDL_Texture* texture = sprite(renderer, shape, r);
+    if (!texture) return;
+    tint(texture, color);
+    const SDL_Rect src[4] = {{0, 0, r, r}, {r, 0, r, r}, {0, r, r, r}, {r, r, r, r}};
+    const SDL_Rect dst[4] = {
+        {rect.x, rect.y, r, r},
+        {rect.x + rect.w - r, rect.y, r, r},
+        {rect.x, rect.y + rect.h - r, r, r},
+        {rect.x + rect.w - r, rect.y + rect.h - r, r, r},
+    };
+    for (int i = 0; i < 4; ++i) SDL_RenderCopy(renderer, texture, &src[i], &dst[i]);
+    Profiler::countDrawCalls(4);
+}
+
+} // namespace
+
+void drawCornerDiscs(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color color) {
+    drawCorners(renderer, Shape::CornerDiscs, rect, radius, color);
+}
+
+void drawCornerMask(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color color) {
+    drawCorners(renderer, Shape::CornerMask, rect, radius, color);
+}
+
+void drawDisc(SDL_Renderer* renderer, int cx, int cy, int radius, SDL_Color color) {
+    if (radius < 0) return;
+    SDL_Texture* texture = sprite(renderer, Shape::Disc, radius);
+    if (!texture) return;
+    tint(texture, color);
+    SDL_Rect dst = {cx - radius, cy - radius, 2 * radius + 1, 2 * radius + 1};
+    SDL_RenderCopy(renderer, texture, NULL, &dst);
+    Profiler::countDrawCalls(1);
+}
+
+void clear() {
+    for (auto& t : textures) if (t.second) SDL_DestroyTexture(t.second);
+    textures.clear();
+}
+
+}
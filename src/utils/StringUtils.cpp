@@ -1,4 +1,93 @@
 #include "include/StringUtils.h"
+#include "include/Patterns.h"
+#include "include/HtmlEntities.h"
+
+namespace {
+
+    // Text is drawn with TTF_RenderText (Latin-1), so anything outside printable ASCII is either
+    // spelled with ASCII or dropped. U+00A0..U+00FF:
+    const char* const kLatin1Fold[96] = {
+        " ", "!", "c", "GBP", "", "JPY", "|", "", "", "(c)", "a", "<<", "-", "", "(R)", "-",
+        "o", "+/-", "2", "3", "'", "u", "", ".", ",", "1", "o", ">>", "1/4", "1/2", "3/4", "?",
+        "A", "A", "A", "A", "A", "A", "AE", "C", "E", "E", "E", "E", "I", "I", "I", "I",
+        "D", "N", "O", "O", "O", "O", "O", "x", "O", "U", "U", "U", "U", "Y", "TH", "ss",
+        "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+        "d", "n", "o", "o", "o", "o", "o", "/", "o", "u", "u", "u", "u", "y", "th", "y",
+    };
+
+    struct Fold { unsigned cp; const char* ascii; };
+    // Sorted by code point
+    const Fold kPunctuationFold[] = {
+        {0x152, "OE"}, {0x153, "oe"}, {0x160, "S"}, {0x161, "s"}, {0x178, "Y"}, {0x17D, "Z"}, {0x17E, "z"},
+        {0x192, "f"}, {0x2C6, "^"}, {0x2DC, "~"},
+        {0x2002, " "}, {0x2003, " "}, {0x2009, " "}, {0x2010, "-"}, {0x2011, "-"}, {0x2012, "-"},
+        {0x2013, "-"}, {0x2014, "-"}, {0x2015, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201A, ","},
+        {0x201C, "\""}, {0x201D, "\""}, {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."},
+        {0x2030, "%o"}, {0x2032, "'"}, {0x2033, "\""}, {0x2039, "<"}, {0x203A, ">"}, {0x2044, "/"},
+        {0x20AC, "EUR"}, {0x2122, "TM"}, {0x2190, "<-"}, {0x2192, "->"}, {0x2212, "-"}, {0x2260, "!="},
+        {0x2264, "<="}, {0x2265, ">="}, {0x2605, "*"}, {0x2606, "*"},
+    };
+
+    void appendCodepoint(std::string& out, unsigned cp) {
+        if (cp < 0x80) {
+            if (cp == '\n' || (cp >= 0x20 && cp < 0x7F)) out += (char)cp;
+            return;
+        }
+        if (cp >= 0xA0 && cp <= 0xFF) {
+            out += kLatin1Fold[cp - 0xA0];
+            return;
+        }
+        const Fold* end = kPunctuationFold + sizeof(kPunctuationFold) / sizeof(kPunctuationFold[0]);
+        const Fold* it = std::lower_bound(kPunctuationFold, end, cp, [](const Fold& f, unsigned v) { return f.cp < v; });
+        if (it != end && it->cp == cp) out += it->ascii;
+    }
+
+    // Decodes "&name;", "&#NNN;" or "&#xHH;" at p (which points at '&') into out and returns the
+    // position after ';'. Returns nullptr for a bare '&' so the caller keeps it literally.
+    const char* decodeEntity(const char* p, const char* end, std::string& out) {
+        const char* q = p + 1;
+        if (q < end && *q == '#') {
+            ++q;
+            bool hex = q < end && (*q == 'x' || *q == 'X');
+            if (hex) ++q;
+            const char* digits = q;
+            unsigned long cp = 0;
+            while (q < end && (hex ? isxdigit((unsigned char)*q) : isdigit((unsigned char)*q))) {
+                int d = isdigit((unsigned char)*q) ? *q - '0' : (tolower((unsigned char)*q) - 'a' + 10);
+                if (cp <= 0x10FFFF) cp = cp * (hex ? 16 : 10) + d;
+                ++q;
+            }
+            if (q == digits || q >= end || *q != ';') return nullptr;
+            appendCodepoint(out, cp > 0x10FFFF ? 0xFFFD : (unsigned)cp);
+            return q + 1;
+        }
+        const char* name = q;
+        while (q < end && q - name <= 32 && isalnum((unsigned char)*q)) ++q;
+        if (q == name || q >= end || *q != ';') return nullptr;
+        unsigned first, second;
+        if (!HtmlEntities::lookup(name, q - name, first, second)) return nullptr;
+        appendCodepoint(out, first);
+        if (second) appendCodepoint(out, second);
+        return q + 1;
+    }
+
+    // One UTF-8 sequence at p (lead byte >= 0x80); malformed bytes are consumed one at a time as U+FFFD
+    const char* decodeUtf8(const char* p, const char* end, unsigned& cp) {
+        unsigned char c = (unsigned char)*p;
+        int len = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 0;
+        cp = 0xFFFD;
+        if (len == 0 || end - p < len) return p + 1;
+        unsigned value = c & (0x7F >> len);
+        for (int k = 1; k < len; ++k) {
+            unsigned char cc = (unsigned char)p[k];
+            if ((cc & 0xC0) != 0x80) return p + 1;
+            value = (value << 6) | (cc & 0x3F);
+        }
+        cp = value;
+        return p + len;
+    }
+
+}
 
 namespace StringUtils {
 
@@ -37,75 +126,47 @@ namespace StringUtils {
         return out;
     }
 
-    std::string cleanHtmlText(const std::string& input) {
-        std::string result = input;
-        auto start = result.find_first_not_of(" \t\n\r\f\v");
-        if (start != std::string::npos) result = result.substr(start); else return "";
-        auto end = result.find_last_not_of(" \t\n\r\f\v");
-        if (end != std::string::npos) result = result.substr(0, end + 1);
-        std::vector<std::pair<std::string, std::string>> replacements = {
-            {"&amp;", "&"}, {"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""}, {"&nbsp;", " "}, {"\r", ""} // removed {"\n", " "}
-        };
-        for (const auto& rep : replacements) {
-            size_t pos = 0;
-            while ((pos = result.find(rep.first, pos)) != std::string::npos) {
-                result.replace(pos, rep.first.length(), rep.second);
-                pos += rep.second.length();
-            }
-        }
-        // Decode numeric HTML entities (e.g., &#8211;)
-        std::regex numEntity(R"(&#(\d+);)");
+    std::string normalizeConsoleName(const std::string& name) {
+        std::string s = name;
+        s = std::regex_replace(s, Patterns::parenthesized(), "");
+        s = std::regex_replace(s, Patterns::bracketed(), "");
+        s = std::regex_replace(s, Patterns::romIsoNoise(), " ");
+        s = std::regex_replace(s, Patterns::outerWhitespace(), "");
+        std::transform(s.begin(), s.end(), s.begin(), ::tolower);
+        s = std::regex_replace(s, Patterns::spaceRuns(), " ");
+        return s;
+    }
+
+    std::string romsConsolePath(const std::string& url) {
         std::smatch m;
-        while (std::regex_search(result, m, numEntity)) {
-            if (m.size() > 1) {
-                int code = std::stoi(m[1].str());
-                std::string utf8;
-                if (code < 0x80) utf8 += static_cast<char>(code);
-                else if (code < 0x800) {
-                    utf8 += static_cast<char>(0xC0 | (code >> 6));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                } else if (code < 0x10000) {
-                    utf8 += static_cast<char>(0xE0 | (code >> 12));
-                    utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                } else {
-                    utf8 += static_cast<char>(0xF0 | (code >> 18));
-                    utf8 += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                }
-                result.replace(m.position(0), m.length(0), utf8);
-            } else {
-                break;
+        if (std::regex_search(url, m, Patterns::romsConsolePath())) return "/roms/" + m[1].str();
+        return "";
+    }
+
+    std::string cleanHtmlText(const std::string& input) {
+        const char* p = input.data();
+        const char* end = p + input.size();
+        // Trim the raw text; a decoded &nbsp; at either edge is kept, as before
+        while (p < end && isspace((unsigned char)*p)) ++p;
+        while (end > p && isspace((unsigned char)end[-1])) --end;
+        std::string result;
+        result.reserve(end - p);
+        while (p < end) {
+            unsigned char c = (unsigned char)*p;
+            if (c == '&') {
+                const char* next = decodeEntity(p, end, result);
+                if (next) { p = next; continue; }
             }
-        }
-        // Decode hexadecimal HTML entities (e.g., &#x27;)
-        std::regex hexEntity(R"(&#x([0-9A-Fa-f]+);)");
-        while (std::regex_search(result, m, hexEntity)) {
-            if (m.size() > 1) {
-                int code = std::stoi(m[1].str(), nullptr, 16);
-                std::string utf8;
-                if (code < 0x80) utf8 += static_cast<char>(code);
-                else if (code < 0x800) {
-                    utf8 += static_cast<char>(0xC0 | (code >> 6));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                } else if (code < 0x10000) {
-                    utf8 += static_cast<char>(0xE0 | (code >> 12));
-                    utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                } else {
-                    utf8 += static_cast<char>(0xF0 | (code >> 18));
-                    utf8 += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
-                    utf8 += static_cast<char>(0x80 | (code & 0x3F));
-                }
-                result.replace(m.position(0), m.length(0), utf8);
-            } else {
-                break;
+            if (c < 0x80) {
+                // Printable ASCII and newlines only (drops \r, tabs and other controls)
+                if (c == '\n' || (c >= 0x20 && c < 0x7F)) result += (char)c;
+                ++p;
+                continue;
             }
+            unsigned cp;
+            p = decodeUtf8(p, end, cp);
+            appendCodepoint(result, cp);
         }
-        // Remove non-printable except newlines
-        result.erase(std::remove_if(result.begin(), result.end(), [](unsigned char c) { return c != '\n' && !std::isprint(c); }), result.end());
         return result;
     }
 }
\ No newline at end of file
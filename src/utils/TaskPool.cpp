@@ -0,0 +1,146 @@
+#include "include/TaskPool.h"
+#include "include/MpscQueue.h"
+
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TaskPool {
+namespace {
+
+// One slot can be held for minutes by a ROM download, the rest serve scrapes
+const int kWorkers = 4;
+
+struct Task {
+    Priority priority;
+    CancelToken token;
+    std::function<void()> work;
+};
+
+struct Completion {
+    CancelToken token;
+    std::function<void()> fn;
+};
+
+std::mutex poolMutex;
+std::condition_variable wake;
+std::list<Task> queue;
+std::list<CancelToken> running;      // tokens of tasks on a worker, cancelled on shutdown
+std::vector<std::thread> workers;
+bool stopping = false;
+std::atomic<Uint32> wakeEvent{(Uint32)-1};
+
+// Worker -> main thread handoff stays off poolMutex so the main loop never waits on a worker
+MpscQueue<Completion> completions;
+std::atomic<bool> wakePending{false};   // a wake-up event is queued and not yet answered
+std::atomic<bool> accepting{true};
+
+thread_local const Task* currentTask = nullptr;
+
+// Highest priority first, oldest first within a priority; cancelled tasks are discarded
+bool takeLocked(Task& out) {
+    auto best = queue.end();
+    for (auto it = queue.begin(); it != queue.end();) {
+        if (it->token.isCancelled()) { it = queue.erase(it); continue; }
+        if (best == queue.end() || it->priority > best->priority) best = it;
+        ++it;
+    }
+    if (best == queue.end()) return false;
+    out = std::move(*best);
+    queue.erase(best);
+    return true;
+}
+
+void workerLoop() {
+    for (;;) {
+        Task task;
+        std::list<CancelToken>::iterator slot;
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            wake.wait(lock, [] { return stopping || !queue.empty(); });
+            if (stopping) return;
+            if (!takeLocked(task)) continue;
+            slot = running.insert(running.end(), task.token);
+        }
+        currentTask = &task;
+        task.work();
+        currentTask = nullptr;
+        std::lock_guard<std::mutex> lock(poolMutex);
+        running.erase(slot);
+    }
+}
+
+void startLocked() {
+    if (!workers.empty() || stopping) return;
+    wakeEvent = SDL_RegisterEvents(1);
+    for (int i = 0; i < kWorkers; ++i) workers.emplace_back(workerLoop);
+}
+
+} // namespace
+
+void submit(Priority priority, const CancelToken& token, std::function<void()> work) {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    startLocked();
+    if (stopping || token.isCancelled()) return;
+    queue.push_back(Task{priority, token, std::move(work)});
+    wake.notify_one();
+}
+
+bool cancelled() {
+    return currentTask && currentTask->token.isCancelled();
+}
+
+CancelToken currentToken() {
+    return currentTask ? currentTask->token : CancelToken();
+}
+
+Priority currentPriority() {
+    return currentTask ? currentTask->priority : Priority::Normal;
+}
+
+void post(const CancelToken& token, std::function<void()> fn) {
+    if (!accepting) return;
+    completions.push(Completion{token, std::move(fn)});
+    // One wake-up per batch: the main loop drains everything queued by then
+    Uint32 type = completionEvent();
+    if (type != (Uint32)-1 && !wakePending.exchange(true)) {
+        SDL_Event event; SDL_zero(event);
+        event.type = type;
+        SDL_PushEvent(&event);
+    }
+}
+
+Uint32 completionEvent() {
+    return wakeEvent;
+}
+
+bool drainCompletions(Uint32 budgetMs) {
+    wakePending = false;
+    Uint32 start = SDL_GetTicks();
+    Completion c;
+    // At least one per call; a completion may cancel others (e.g. by popping a screen), so
+    // each is checked right before it runs
+    while (completions.pop(c)) {
+        if (!c.token.isCancelled()) c.fn();
+        c = Completion();
+        if (SDL_GetTicks() - start >= budgetMs) return !completions.empty();
+    }
+    return false;
+}
+
+void shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        stopping = true;
+        accepting = false;
+        queue.clear();
+        for (const CancelToken& token : running) token.cancel();
+    }
+    wake.notify_all();
+    for (auto& t : workers) if (t.joinable()) t.join();
+    workers.clear();
+}
+
+} // namespace TaskPool
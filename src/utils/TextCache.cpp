@@ -0,0 +1,190 @@
+#include "include/TextCache.h"
+#include "include/TextureAtlas.h"
+#include "include/Profiler.h"
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace TextCache {
+namespace {
+
+// 1024x1024 pages hold a few hundred labels each; four pages = 16 MB of RGBA
+const int kPageSize = 1024;
+const int kMaxPages = 4;
+// Runs that don't fit a page (long wrapped paragraphs) get their own textures, capped here
+const size_t kOwnTextureBudget = 8 * 1024 * 1024;
+const size_t kMaxLayouts = 4096;
+
+struct RunKey {
+    TTF_Font* font;
+    int style;
+    Mode mode;
+    int wrapWidth;
+    std::string text;
+    bool operator==(const RunKey& o) const {
+        return font == o.font && style == o.style && mode == o.mode && wrapWidth == o.wrapWidth && text == o.text;
+    }
+};
+
+struct LayoutKey {
+    TTF_Font* font;
+    int style;
+    char kind;
+    int width;
+    int lines;
+    std::string text;
+    bool operator==(const LayoutKey& o) const {
+        return font == o.font && style == o.style && kind == o.kind && width == o.width && lines == o.lines && text == o.text;
+    }
+};
+
+inline size_t combine(size_t seed, size_t v) { return seed ^ (v + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)); }
+
+struct RunKeyHash {
+    size_t operator()(const RunKey& k) const {
+        size_t h = std::hash<std::string>{}(k.text);
+        h = combine(h, std::hash<const void*>{}(k.font));
+        h = combine(h, (size_t)k.style * 31 + (size_t)k.mode);
+        return combine(h, (size_t)k.wrapWidth);
+    }
+};
+
+struct LayoutKeyHash {
+    size_t operator()(const LayoutKey& k) const {
+        size_t h = std::hash<std::string>{}(k.text);
+        h = combine(h, std::hash<const void*>{}(k.font));
+        h = combine(h, (size_t)k.style * 131 + (size_t)k.kind);
+        return combine(h, (size_t)k.width * 7 + (size_t)k.lines);
+    }
+};
+
+struct RunEntry {
+    TextureAtlas::Region region;
+    SDL_Texture* own = nullptr;        // set instead of region for oversized runs
+    int w = 0, h = 0;
+    std::list<const RunKey*>::iterator lru;
+};
+
+std::unique_ptr<TextureAtlas> atlas;
+std::unordered_map<RunKey, RunEntry, RunKeyHash> runs;
+std::list<const RunKey*> lruOrder;     // most recently drawn first; points at keys in runs
+size_t ownBytes = 0;
+std::unordered_map<LayoutKey, std::vector<std::string>, LayoutKeyHash> layouts;
+Stats counters;
+
+void eraseRun(std::unordered_map<RunKey, RunEntry, RunKeyHash>::iterator it) {
+    if (it->second.own) {
+        SDL_DestroyTexture(it->second.own);
+        ownBytes -= (size_t)it->second.w * it->second.h * 4;
+    } else {
+        atlas->release(it->second.region);
+    }
+    lruOrder.erase(it->second.lru);
+    runs.erase(it);
+    counters.runEvictions++;
+}
+
+bool evictLeastRecent() {
+    if (lruOrder.empty()) return false;
+    eraseRun(runs.find(*lruOrder.back()));
+    return true;
+}
+
+SDL_Surface* rasterize(TTF_Font* font, const std::string& text, Mode mode, int wrapWidth) {
+    Profiler::Scope scope("TextCache::rasterize");
+    const SDL_Color white = {255, 255, 255, 255};
+    switch (mode) {
+        case Mode::Solid: return TTF_RenderText_Solid(font, text.c_str(), white);
+        case Mode::Blended: return TTF_RenderText_Blended(font, text.c_str(), white);
+        case Mode::Wrapped: return TTF_RenderText_Blended_Wrapped(font, text.c_str(), white, (Uint32)wrapWidth);
+    }
+    return nullptr;
+}
+
+} // namespace
+
+bool get(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, Mode mode, int wrapWidth, Run& out) {
+    if (!font || text.empty()) return false;
+    RunKey key{font, TTF_GetFontStyle(font), mode, mode == Mode::Wrapped ? wrapWidth : 0, text};
+    auto it = runs.find(key);
+    if (it != runs.end()) {
+        counters.runHits++;
+        lruOrder.splice(lruOrder.begin(), lruOrder, it->second.lru);
+    } else {
+        counters.runMisses++;
+        SDL_Surface* surface = rasterize(font, text, mode, wrapWidth);
+        if (!surface) return false;
+        if (!atlas) atlas.reset(new TextureAtlas(kPageSize, kMaxPages));
+        RunEntry entry;
+        entry.w = surface->w;
+        entry.h = surface->h;
+        bool fitsPage = surface->w < kPageSize && surface->h < kPageSize;
+        bool placed = false;
+        while (fitsPage && !(placed = atlas->insert(renderer, surface, entry.region))) {
+            if (!evictLeastRecent()) break;
+        }
+        if (!placed) {
+            entry.own = SDL_CreateTextureFromSurface(renderer, surface);
+            if (!entry.own) {
+                SDL_FreeSurface(surface);
+                return false;
+            }
+            SDL_SetTextureBlendMode(entry.own, SDL_BLENDMODE_BLEND);
+            ownBytes += (size_t)entry.w * entry.h * 4;
+        }
+        SDL_FreeSurface(surface);
+        it = runs.emplace(std::move(key), entry).first;
+        lruOrder.push_front(&it->first);
+        it->second.lru = lruOrder.begin();
+        // Keep oversized runs bounded, but never evict the one just created
+        while (ownBytes > kOwnTextureBudget && lruOrder.size() > 1) evictLeastRecent();
+        Profiler::setTextureBytes("text", atlas->bytes() + ownBytes);
+    }
+    const RunEntry& e = it->second;
+    out.texture = e.own ? e.own : atlas->texture(e.region.page);
+    out.rect = e.own ? SDL_Rect{0, 0, e.w, e.h} : e.region.rect;
+    return out.texture != nullptr;
+}
+
+void draw(SDL_Renderer* renderer, const Run& run, const SDL_Rect& dst, SDL_Color color) {
+    if (!run.texture) return;
+    SDL_SetTextureColorMod(run.texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(run.texture, color.a);
+    SDL_RenderCopy(renderer, run.texture, &run.rect, &dst);
+    Profiler::countDrawCalls(1);
+}
+
+const std::vector<std::string>* findLayout(TTF_Font* font, char kind, const std::string& text, int width, int lines) {
+    auto it = layouts.find(LayoutKey{font, TTF_GetFontStyle(font), kind, width, lines, text});
+    if (it == layouts.end()) {
+        counters.layoutMisses++;
+        return nullptr;
+    }
+    counters.layoutHits++;
+    return &it->second;
+}
+
+const std::vector<std::string>& storeLayout(TTF_Font* font, char kind, const std::string& text, int width, int lines,
+                                            std::vector<std::string> layout) {
+    // Layouts are cheap to recompute; start over rather than track recency
+    if (layouts.size() >= kMaxLayouts) layouts.clear();
+    auto& slot = layouts[LayoutKey{font, TTF_GetFontStyle(font), kind, width, lines, text}];
+    slot = std::move(layout);
+    return slot;
+}
+
+Stats stats() { return counters; }
+
+void clear() {
+    for (auto& r : runs) if (r.second.own) SDL_DestroyTexture(r.second.own);
+    runs.clear();
+    lruOrder.clear();
+    ownBytes = 0;
+    atlas.reset();
+    layouts.clear();
+    Profiler::setTextureBytes("text", 0);
+}
+
+}
@@ -0,0 +1,116 @@
+#include "include/TextureAtlas.h"
+#include "include/Profiler.h"
+
+namespace {
+
+// Gap between packed images so linear filtering never samples a neighbour
+const int kPadding = 1;
+
+} // namespace
+
+TextureAtlas::TextureAtlas(int pageSize, int maxPages) : size(pageSize), maxPages(maxPages) {}
+
+TextureAtlas::~TextureAtlas() { clear(); }
+
+// Best shelf: a free span or the tail of a shelf that is tall enough but wastes at most a
+// quarter of its height; otherwise open a new shelf below the last one.
+bool TextureAtlas::place(Page& page, int w, int h, SDL_Rect& out) {
+    for (auto& shelf : page.shelves) {
+        if (h > shelf.height || shelf.height > h + h / 4) continue;
+        for (size_t i = 0; i < shelf.freeSpans.size(); ++i) {
+            Span& span = shelf.freeSpans[i];
+            if (span.w < w) continue;
+            out = {span.x, shelf.y, w, h};
+            span.x += w;
+            span.w -= w;
+            if (span.w == 0) shelf.freeSpans.erase(shelf.freeSpans.begin() + i);
+            shelf.live++;
+            return true;
+        }
+        if (shelf.cursorX + w <= size) {
+            out = {shelf.cursorX, shelf.y, w, h};
+            shelf.cursorX += w;
+            shelf.live++;
+            return true;
+        }
+    }
+    if (page.nextShelfY + h > size) return false;
+    Shelf shelf;
+    shelf.y = page.nextShelfY;
+    shelf.height = h;
+    shelf.cursorX = w;
+    shelf.live = 1;
+    page.shelves.push_back(shelf);
+    page.nextShelfY += h;
+    out = {0, shelf.y, w, h};
+    return true;
+}
+
+bool TextureAtlas::insert(SDL_Renderer* renderer, SDL_Surface* surface, Region& out) {
+    Profiler::Scope scope("TextureAtlas::insert");
+    if (!surface) return false;
+    int w = surface->w + kPadding, h = surface->h + kPadding;
+    if (w > size || h > size) return false;
+
+    SDL_Surface* rgba = surface;
+    if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+        rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        if (!rgba) return false;
+    }
+
+    SDL_Rect slot;
+    int pageIndex = -1;
+    for (size_t i = 0; i < pages.size() && pageIndex < 0; ++i)
+        if (place(pages[i], w, h, slot)) pageIndex = (int)i;
+    if (pageIndex < 0 && (int)pages.size() < maxPages) {
+        Page page;
+        page.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, size, size);
+        if (page.texture) {
+            SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+            pages.push_back(page);
+            if (place(pages.back(), w, h, slot)) pageIndex = (int)pages.size() - 1;
+        }
+    }
+    if (pageIndex < 0) {
+        if (rgba != surface) SDL_FreeSurface(rgba);
+        return false;
+    }
+
+    Page& page = pages[pageIndex];
+    SDL_Rect dst = {slot.x, slot.y, surface->w, surface->h};
+    SDL_UpdateTexture(page.texture, &dst, rgba->pixels, rgba->pitch);
+    if (rgba != surface) SDL_FreeSurface(rgba);
+    page.live++;
+    out.page = pageIndex;
+    out.rect = dst;
+    return true;
+}
+
+void TextureAtlas::release(const Region& region) {
+    if (!region.valid() || region.page >= (int)pages.size()) return;
+    Page& page = pages[region.page];
+    for (auto& shelf : page.shelves) {
+        if (shelf.y != region.rect.y) continue;
+        shelf.live--;
+        if (shelf.live <= 0) {
+            shelf.live = 0;
+            shelf.cursorX = 0;
+            shelf.freeSpans.clear();
+        } else {
+            shelf.freeSpans.push_back(Span{region.rect.x, region.rect.w + kPadding});
+        }
+        break;
+    }
+    page.live--;
+    // An empty page starts over, so its shelves can be re-cut for different sizes
+    if (page.live <= 0) {
+        page.live = 0;
+        page.shelves.clear();
+        page.nextShelfY = 0;
+    }
+}
+
+void TextureAtlas::clear() {
+    for (auto& page : pages) if (page.texture) SDL_DestroyTexture(page.texture);
+    pages.clear();
+}
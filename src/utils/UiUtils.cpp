@@ -1,119 +1,162 @@
 #include "include/UiUtils.h"
+#include "include/TextCache.h"
+#include "include/Profiler.h"
 
 
 namespace UiUtils {
     // Color struct implementation
-    Color::Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) : r(r), g(g), b(b), a(a) {}
     SDL_Color Color::toSDLColor() const { return {r, g, b, a}; }
 
     // --- Text Rendering Functions ---
+    // All text goes through TextCache: each string is rasterized once and later frames only draw
+    // it from the text atlas, tinted with the requested color.
+
+    namespace {
+        // TTF_RenderText_Solid treats a zero foreground alpha as opaque; keep that when tinting
+        SDL_Color solidTint(const Color& color) {
+            SDL_Color c = color.toSDLColor();
+            if (c.a == 0) c.a = 255;
+            return c;
+        }
+
+        // Word wrap into at most two lines that fit width, ellipsizing the second (RenderTextCenteredInBox)
+        std::vector<std::string> layoutBoxLines(TTF_Font* font, const std::string& text, int width) {
+            std::vector<std::string> lines;
+            std::istringstream iss(text);
+            std::string word, current;
+            while (iss >> word) {
+                std::string test = current.empty() ? word : current + " " + word;
+                int w = 0, h = 0;
+                TTF_SizeText(font, test.c_str(), &w, &h);
+                if (w > width && !current.empty()) {
+                    lines.push_back(current);
+                    current = word;
+                    if (lines.size() == 2) break;
+                } else {
+                    current = test;
+                }
+            }
+            if (!current.empty() && lines.size() < 2) lines.push_back(current);
+            // If too many lines, truncate and add ellipsis
+            if (lines.size() > 2) lines.resize(2);
+            if (lines.size() == 2) {
+                int w = 0, h = 0;
+                TTF_SizeText(font, lines[1].c_str(), &w, &h);
+                if (w > width) {
+                    // Truncate with ellipsis
+                    std::string& s = lines[1];
+                    while (!s.empty() && w > width) {
+                        s.pop_back();
+                        TTF_SizeText(font, (s + "...").c_str(), &w, &h);
+                    }
+                    s += "...";
+                }
+            }
+            return lines;
+        }
+
+        // Same as ClampTextToLines, uncached
+        std::string clampToLines(TTF_Font* font, const std::string& text, int maxWidth, int maxLines) {
+            std::vector<std::string> lines;
+            std::istringstream iss(text);
+            std::string word, current;
+            while (iss >> word && lines.size() < maxLines) {
+                std::string test = current.empty() ? word : current + " " + word;
+                int w = 0, h = 0;
+                TTF_SizeText(font, test.c_str(), &w, &h);
+                if (w > maxWidth && !current.empty()) {
+                    lines.push_back(current);
+                    current = word;
+                } else {
+                    current = test;
+                }
+            }
+            if (!current.empty() && lines.size() < maxLines) {
+                lines.push_back(current);
+            }
+            // If we have the maximum number of lines and there's still text, add ellipsis
+            if (lines.size() == maxLines && iss >> word) {
+                std::string& lastLine = lines.back();
+                int w = 0, h = 0;
+                TTF_SizeText(font, (lastLine + "...").c_str(), &w, &h);
+                while (w > maxWidth && !lastLine.empty()) {
+                    lastLine.pop_back();
+                    TTF_SizeText(font, (lastLine + "...").c_str(), &w, &h);
+                }
+                lastLine += "...";
+            }
+            std::string result;
+            for (size_t i = 0; i < lines.size(); ++i) {
+                if (i > 0) result += " ";
+                result += lines[i];
+            }
+            return result;
+        }
+    }
 
     // Draws a single line of text centered at (x, y) in screen coordinates. The text baseline is centered both horizontally and vertically. Used for menu labels, buttons, etc.
     void RenderTextCentered(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, const Color& color) {
+        Profiler::Scope scope("UiUtils::RenderTextCentered");
         if (!font) return;
         int prevStyle = TTF_GetFontStyle(font);
         TTF_SetFontStyle(font, prevStyle | TTF_STYLE_BOLD);
-        SDL_Surface* surface = TTF_RenderText_Solid(font, text.c_str(), color.toSDLColor());
-        if (!surface) { TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (!texture) { SDL_FreeSurface(surface); TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Rect destRect = {x - surface->w / 2, y - surface->h / 2, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, NULL, &destRect);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(surface);
+        TextCache::Run run;
+        if (TextCache::get(renderer, font, text, TextCache::Mode::Solid, 0, run)) {
+            SDL_Rect destRect = {x - run.rect.w / 2, y - run.rect.h / 2, run.rect.w, run.rect.h};
+            TextCache::draw(renderer, run, destRect, solidTint(color));
+        }
         TTF_SetFontStyle(font, prevStyle);
     }
 
     // Draws a single line of text at (x, y) in screen coordinates, with optional scaling. The top-left of the text is placed at (x, y). Used for labels, tooltips, etc.
     void RenderText(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, const Color& color, float scale) {
+        Profiler::Scope scope("UiUtils::RenderText");
         if (!font) return;
         int prevStyle = TTF_GetFontStyle(font);
         TTF_SetFontStyle(font, prevStyle | TTF_STYLE_BOLD);
-        SDL_Surface* surface = TTF_RenderText_Solid(font, text.c_str(), color.toSDLColor());
-        if (!surface) { TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (!texture) { SDL_FreeSurface(surface); TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Rect destRect = {x, y, int(surface->w * scale), int(surface->h * scale)};
-        SDL_RenderCopy(renderer, texture, NULL, &destRect);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(surface);
+        TextCache::Run run;
+        if (TextCache::get(renderer, font, text, TextCache::Mode::Solid, 0, run)) {
+            SDL_Rect destRect = {x, y, int(run.rect.w * scale), int(run.rect.h * scale)};
+            TextCache::draw(renderer, run, destRect, solidTint(color));
+        }
         TTF_SetFontStyle(font, prevStyle);
     }
 
     // Draws multi-line text at (x, y), automatically wrapping lines to fit within maxWidth pixels. The top-left of the first line is placed at (x, y). Used for paragraphs, descriptions, etc.
     void RenderTextWrapped(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, int maxWidth, const Color& color) {
+        Profiler::Scope scope("UiUtils::RenderTextWrapped");
         if (!font) return;
         int prevStyle = TTF_GetFontStyle(font);
         TTF_SetFontStyle(font, prevStyle | TTF_STYLE_BOLD);
-        SDL_Surface* surface = TTF_RenderText_Blended_Wrapped(font, text.c_str(), color.toSDLColor(), maxWidth);
-        if (!surface) { TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (!texture) { SDL_FreeSurface(surface); TTF_SetFontStyle(font, prevStyle); return; }
-        SDL_Rect destRect = {x, y, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, NULL, &destRect);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(surface);
+        TextCache::Run run;
+        if (TextCache::get(renderer, font, text, TextCache::Mode::Wrapped, maxWidth, run)) {
+            SDL_Rect destRect = {x, y, run.rect.w, run.rect.h};
+            TextCache::draw(renderer, run, destRect, color.toSDLColor());
+        }
         TTF_SetFontStyle(font, prevStyle);
     }
 
     // Draws up to two lines of text, word-wrapped and centered within the given SDL_Rect box. If the text is too long, it is truncated with an ellipsis. Used for compact UI elements like cards or tiles.
     void RenderTextCenteredInBox(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, const SDL_Rect& box, const Color& color) {
+        Profiler::Scope scope("UiUtils::RenderTextCenteredInBox");
         if (!font) return;
         int prevStyle = TTF_GetFontStyle(font);
         TTF_SetFontStyle(font, prevStyle | TTF_STYLE_BOLD);
-        // Word wrap: split into lines that fit box.w, up to 2 lines
-        std::vector<std::string> lines;
-        std::istringstream iss(text);
-        std::string word, current;
-        while (iss >> word) {
-            std::string test = current.empty() ? word : current + " " + word;
-            int w = 0, h = 0;
-            TTF_SizeText(font, test.c_str(), &w, &h);
-            if (w > box.w && !current.empty()) {
-                lines.push_back(current);
-                current = word;
-                if (lines.size() == 2) break;
-            } else {
-                current = test;
-            }
-        }
-        if (!current.empty() && lines.size() < 2) lines.push_back(current);
-        // If too many lines, truncate and add ellipsis
-        if (lines.size() > 2) lines.resize(2);
-        if (lines.size() == 2) {
-            int w = 0, h = 0;
-            TTF_SizeText(font, lines[1].c_str(), &w, &h);
-            if (w > box.w) {
-                // Truncate with ellipsis
-                std::string& s = lines[1];
-                while (!s.empty() && w > box.w) {
-                    s.pop_back();
-                    TTF_SizeText(font, (s + "...").c_str(), &w, &h);
-                }
-                s += "...";
-            }
-        }
-        int totalH = 0, lineH = 0;
-        for (const auto& l : lines) {
-            int w = 0, h = 0;
-            TTF_SizeText(font, l.c_str(), &w, &h);
-            totalH += h;
-            lineH = h;
+        const std::vector<std::string>* cached = TextCache::findLayout(font, 'b', text, box.w, 2);
+        const std::vector<std::string>& lines = cached ? *cached : TextCache::storeLayout(font, 'b', text, box.w, 2, layoutBoxLines(font, text, box.w));
+        TextCache::Run runs[2];
+        int totalH = 0;
+        for (size_t i = 0; i < lines.size() && i < 2; ++i) {
+            if (TextCache::get(renderer, font, lines[i], TextCache::Mode::Solid, 0, runs[i])) totalH += runs[i].rect.h;
         }
         int y = box.y + (box.h - totalH) / 2;
-        for (const auto& l : lines) {
-            int w = 0, h = 0;
-            TTF_SizeText(font, l.c_str(), &w, &h);
-            int x = box.x + (box.w - w) / 2;
-            SDL_Surface* surface = TTF_RenderText_Solid(font, l.c_str(), color.toSDLColor());
-            if (!surface) continue;
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (!texture) { SDL_FreeSurface(surface); continue; }
-            SDL_Rect destRect = {x, y, surface->w, surface->h};
-            SDL_RenderCopy(renderer, texture, NULL, &destRect);
-            SDL_DestroyTexture(texture);
-            SDL_FreeSurface(surface);
-            y += h;
+        for (size_t i = 0; i < lines.size() && i < 2; ++i) {
+            const TextCache::Run& run = runs[i];
+            if (!run.texture) continue;
+            int x = box.x + (box.w - run.rect.w) / 2;
+            SDL_Rect destRect = {x, y, run.rect.w, run.rect.h};
+            TextCache::draw(renderer, run, destRect, solidTint(color));
+            y += run.rect.h;
         }
         TTF_SetFontStyle(font, prevStyle);
     }
@@ -122,51 +165,22 @@ namespace UiUtils {
 
     // Returns a string truncated to fit within maxWidth pixels and maxLines lines, adding an ellipsis if the text overflows. Used for previewing long text in limited space.
     std::string ClampTextToLines(const std::string& text, TTF_Font* font, int maxWidth, int maxLines) {
+        Profiler::Scope scope("UiUtils::ClampTextToLines");
         if (!font || maxLines <= 0) return text;
-        std::vector<std::string> lines;
-        std::istringstream iss(text);
-        std::string word, current;
-        while (iss >> word && lines.size() < maxLines) {
-            std::string test = current.empty() ? word : current + " " + word;
-            int w = 0, h = 0;
-            TTF_SizeText(font, test.c_str(), &w, &h);
-            if (w > maxWidth && !current.empty()) {
-                lines.push_back(current);
-                current = word;
-            } else {
-                current = test;
-            }
-        }
-        if (!current.empty() && lines.size() < maxLines) {
-            lines.push_back(current);
-        }
-        // If we have the maximum number of lines and there's still text, add ellipsis
-        if (lines.size() == maxLines && iss >> word) {
-            std::string& lastLine = lines.back();
-            int w = 0, h = 0;
-            TTF_SizeText(font, (lastLine + "...").c_str(), &w, &h);
-            while (w > maxWidth && !lastLine.empty()) {
-                lastLine.pop_back();
-                TTF_SizeText(font, (lastLine + "...").c_str(), &w, &h);
-            }
-            lastLine += "...";
-        }
-        std::string result;
-        for (size_t i = 0; i < lines.size(); ++i) {
-            if (i > 0) result += " ";
-            result += lines[i];
-        }
-        return result;
+        if (const std::vector<std::string>* cached = TextCache::findLayout(font, 'c', text, maxWidth, maxLines)) return cached->front();
+        return TextCache::storeLayout(font, 'c', text, maxWidth, maxLines, {clampToLines(font, text, maxWidth, maxLines)}).front();
     }
 
     // --- Shape Rendering Functions ---
 
     // Draws a filled rectangle with optional rounded corners (if radius > 0) using the given SDL_Color. The rectangle is filled, not stroked. Used for backgrounds, buttons, and UI panels.
     void DrawRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color color) {
+        Profiler::Scope scope("UiUtils::DrawRoundedRect");
         SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
         // If radius is 0 or too small, just draw a regular rectangle
         if (radius <= 0 || radius > rect.w / 2 || radius > rect.h / 2) {
             SDL_RenderFillRect(renderer, &rect);
+            Profiler::countDrawCalls(1);
             return;
         }
         // Draw the main rectangle (middle section)
@@ -177,6 +191,7 @@ namespace UiUtils {
         SDL_Rect bottomRect = {rect.x + radius, rect.y + rect.h - radius, rect.w - 2 * radius, radius};
         SDL_RenderFillRect(renderer, &topRect);
         SDL_RenderFillRect(renderer, &bottomRect);
+        Profiler::countDrawCalls(3);
     }
 
 } 
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+#include <cstddef>
+
+// Named character references (&eacute; &hellip; ...) used by StringUtils::cleanHtmlText
+namespace HtmlEntities {
+    // name is the text between '&' and ';'. Most entities are one code point; a few expand to two
+    // (second is 0 otherwise). Case-sensitive, like HTML.
+    bool lookup(const char* name, size_t length, unsigned& first, unsigned& second);
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <initializer_list>
+
+// Zero-copy HTML tokenizer + simple selector matching used by the scrapers instead of std::regex.
+// Everything works on pointers into the fetched page: one forward pass, no backtracking, and
+// nothing is copied until a value is actually kept (Slice::str()).
+namespace HtmlParser {
+    // Non-owning view into the page (C++14 has no std::string_view)
+    struct Slice {
+        const char* data = nullptr;
+        size_t size = 0;
+
+        Slice() {}
+        Slice(const char* begin, const char* end) : data(begin), size(end > begin ? (size_t)(end - begin) : 0) {}
+        Slice(const std::string& s) : data(s.data()), size(s.size()) {}
+
+        const char* begin() const { return data; }
+        const char* end() const { return data + size; }
+        bool empty() const { return size == 0; }
+        std::string str() const { return std::string(data, size); }
+
+        bool equals(const char* s) const;
+        bool equalsIgnoreCase(const char* s) const;
+        bool startsWith(const char* s) const;
+        bool endsWithIgnoreCase(const char* s) const;
+        bool contains(const char* s) const;
+        Slice trimmed() const;
+        // Pointer to the first occurrence of s, or end()
+        const char* find(const char* s) const;
+    };
+
+    struct Tag {
+        Slice name;
+        Slice attrs;                  // raw text between the name and '>'
+        const char* begin = nullptr;  // '<'
+        const char* end = nullptr;    // just past '>'
+        bool closing = false;
+        bool selfClosing = false;
+
+        bool is(const char* tagName) const { return name.equalsIgnoreCase(tagName); }
+        bool hasAttr(const char* attrName) const;
+        Slice attr(const char* attrName) const;     // unquoted value, empty when missing
+        bool hasClass(const char* cls) const;       // whitespace separated class token
+        bool isVoid() const;                        // img, br, source, ... never have a close tag
+    };
+
+    // Compound simple selector: tag, .class, #id and [attr], [attr=v], [attr*=v], [attr^=v], [attr$=v]
+    // in any combination, e.g. "a.btn[rel=tag]". No combinators; scope a search by tokenizing
+    // an element's inner() instead.
+    class Selector {
+    public:
+        Selector(const char* text);
+        bool matches(const Tag& tag) const;
+    private:
+        struct AttrTest {
+            std::string name;
+            char op = 0;              // 0 = present, '=', '*', '^', '$'
+            std::string value;
+        };
+        std::string tagName;
+        std::vector<std::string> classes;
+        std::vector<AttrTest> attrs;
+    };
+
+    // Forward-only tokenizer over a slice. Comments, doctype and script/style bodies are skipped.
+    class Tokenizer {
+    public:
+        explicit Tokenizer(Slice html) : cur(html.begin()), stop(html.end()) {}
+        bool next(Tag& tag);                             // next open or close tag
+        bool next(const Selector& sel, Tag& tag);        // next open tag matching sel
+        const char* position() const { return cur; }
+        void seek(const char* p) { cur = p; }
+    private:
+        const char* cur;
+        const char* stop;
+    };
+
+    struct Element {
+        Tag open;
+        Slice inner;                  // content between open and matching close tag
+        const char* end = nullptr;    // just past the close tag (or inner end if unclosed)
+    };
+
+    // Inner content of an open tag: runs to the matching close tag, counting nested tags of the same name
+    Element element(const Tag& open, const char* limit);
+
+    // First element matching sel inside html
+    bool find(Slice html, const Selector& sel, Element& out);
+    // Every element matching sel, outermost only (matches nested inside a previous match are skipped)
+    std::vector<Element> findAll(Slice html, const Selector& sel);
+    // Value of attr on the first tag matching sel, empty when none
+    std::string attrOf(Slice html, const Selector& sel, const char* attrName);
+
+    // Text of a fragment with every tag replaced by tagReplacement (entities are left for cleanHtmlText)
+    std::string text(Slice html, const char* tagReplacement = "");
+    // Text of the first element matching sel, empty when none
+    std::string textOf(Slice html, const Selector& sel);
+    // Text from the end of tag up to the next '<' (the old "[^<]+" capture)
+    Slice textAfter(const Tag& tag, const char* limit);
+
+    // First absolute http(s) url in raw text ending in one of extensions (case-insensitive),
+    // e.g. a download link inside inline JavaScript
+    std::string findAbsoluteUrl(Slice html, std::initializer_list<const char*> extensions);
+}
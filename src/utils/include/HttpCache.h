@@ -0,0 +1,26 @@
+#pragma once
+#include <string>
+
+// Persistent cache for scraped HTML pages under cache/http, used by HttpUtils::fetchWebContent.
+// Entries are keyed by a hash of the url (like cache/images) and stored as <hash>.body + <hash>.meta.
+// Each site gets its own freshness TTL; stale entries are revalidated with ETag/Last-Modified
+// and the directory is kept under a byte cap by evicting least recently used pages.
+namespace HttpCache {
+    struct Entry {
+        std::string body;
+        std::string etag;
+        std::string lastModified;
+        bool fresh = false;           // still inside the site's TTL, no request needed
+    };
+
+    // Cached copy of url (fresh or stale); false on miss
+    bool lookup(const std::string& url, Entry& out);
+
+    void store(const std::string& url, const std::string& body, const std::string& etag, const std::string& lastModified);
+
+    // Server answered 304: restart the TTL of the stored copy
+    void touch(const std::string& url);
+
+    // Forget the in-memory index (after Settings wiped the cache directory)
+    void reset();
+}
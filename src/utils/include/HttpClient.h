@@ -0,0 +1,71 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <cstddef>
+
+// Minimal in-process HTTP/1.1 client (plain sockets + OpenSSL) used by HttpUtils.
+// Replaces the old popen("curl")/wget calls so a request costs no fork/exec.
+// Connections are kept alive in a small per-host pool shared by every caller
+// (scrapers, image loader threads, DownloadManager), and TLS sessions are
+// resumed when a new socket to a known host has to be opened.
+namespace HttpClient {
+    // Header list in the order received; lookups are case-insensitive
+    using Headers = std::vector<std::pair<std::string, std::string>>;
+
+    struct Response;
+
+    struct Request {
+        std::string method = "GET";
+        std::string url;
+        Headers headers;              // extra request headers
+        std::string userAgent;        // empty -> default browser UA
+        std::string referer;
+        int connectTimeoutMs = 10000;
+        int timeoutMs = 15000;        // whole transfer incl. redirects, 0 = unlimited
+        int maxRedirects = 10;
+        // Send Accept-Encoding: gzip, deflate and inflate the body on the fly. The response
+        // (body, sink, headers) then looks uncompressed: Content-Encoding/-Length are dropped.
+        bool acceptCompressed = false;
+        // Called once with the final (non-redirect) status and headers, before the body
+        std::function<void(const Response&)> onHeaders;
+    };
+
+    struct Response {
+        int status = 0;               // 0 = transport error (see error)
+        Headers headers;
+        std::string body;             // empty when a BodySink consumed it
+        std::string finalUrl;         // url after redirects
+        std::string error;
+        bool ok() const { return status >= 200 && status < 300; }
+        std::string header(const std::string& name) const;
+    };
+
+    // Receives the body of a 2xx response chunk by chunk; return false to abort.
+    // Non-2xx bodies are always buffered into Response::body instead.
+    using BodySink = std::function<bool(const char* data, size_t len)>;
+
+    Response perform(const Request& request, const BodySink& sink = nullptr);
+
+    struct PoolStats {
+        long connectionsOpened = 0;
+        long connectionsReused = 0;   // requests served on a pooled keep-alive socket
+        long tlsFull = 0;             // full TLS handshakes
+        long tlsResumed = 0;          // abbreviated handshakes via a cached session
+        long idleEvicted = 0;         // idle sockets dropped (timeout, overflow, peer closed)
+        int idleNow = 0;
+    };
+    PoolStats poolStats();
+
+    // Drop every idle pooled socket (e.g. on shutdown)
+    void closeIdleConnections();
+
+    // Resolve a (possibly relative) Location/href against a base url
+    std::string resolveUrl(const std::string& base, const std::string& ref);
+
+    // Base-url override for offline runs against bench/mock_site_server: with
+    // PLUNDER_BASE_URL=http://host:port set, a request for https://site/path goes to
+    // http://host:port/site/path instead. Empty when not set.
+    const std::string& baseUrlOverride();
+}
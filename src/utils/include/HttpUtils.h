@@ -1,12 +1,21 @@
 #pragma once
 #include <string>
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <string>
+#include "HttpClient.h"
+#include "HttpCache.h"
 
 namespace HttpUtils {
     std::string fetchWebContent(const std::string& url);
+    // Fetch pages 1..maxPages (urlForPage builds each url) with up to `window` requests in flight,
+    // handing bodies to onPage strictly in page order; onPage returns false to stop. The fetches
+    // run on the TaskPool as subtasks of the calling task: they are aborted when it is cancelled,
+    // and those still outstanding when this returns are cancelled.
+    void fetchPagesInOrder(const std::function<std::string(int page)>& urlForPage, int maxPages, int window,
+                           const std::function<bool(int page, const std::string& html)>& onPage);
     bool downloadImage(const std::string& url, const std::string& outputPath);
     bool downloadFile(const std::string& url, const std::string& outputPath); // Robust HTTPS download
     bool hasInternet();
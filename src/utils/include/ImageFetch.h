@@ -0,0 +1,60 @@
+#pragma once
+#include <string>
+#include <SDL2/SDL.h>
+
+// Shared background image fetcher for the list screens. One small worker pool serves every
+// screen; queued jobs are ordered by distance from the owner's viewport (biased toward the
+// scroll direction), jobs that scroll far away are dropped, and idle workers sleep on a
+// condition variable instead of polling. Workers also decode (and downscale) the image, so the
+// render thread only uploads finished surfaces. Finished surfaces reach the render thread
+// through a lock-free queue; everything but the workers runs on the render thread.
+namespace ImageFetch {
+    struct Result {
+        int index = -1;
+        std::string url;
+        std::string path;             // local file, valid when ok
+        bool ok = false;
+        SDL_Surface* surface = nullptr; // RGBA32 or RGB565, owned by the caller after poll(); nullptr when !ok
+    };
+
+    struct Stats {
+        unsigned long requested = 0;
+        unsigned long completed = 0;
+        unsigned long failed = 0;      // download or decode
+        unsigned long dropped = 0;     // scrolled out of range or cancelled before a worker got to it
+    };
+
+    // Each list screen registers once and gets its own queue position, viewport and results
+    int registerOwner();
+    void unregisterOwner(int owner);
+
+    // Fetch url into path (skipped when path already exists; url may be the local path itself)
+    // and decode it for item index, cropped and downscaled to coverW x coverH when given. Remote
+    // images also get a compact thumbnail next to path, so later requests skip decode and
+    // scaling. Ignored if that index is already queued, in flight, or failed since the last cancel().
+    void request(int owner, int index, const std::string& url, const std::string& path, int coverW = 0, int coverH = 0);
+
+    // Same fetch and thumbnail write, for an item the owner does not show yet: no result comes
+    // back and the index is not claimed (index only places the job in the queue), so a later
+    // request() for it is never skipped, whether this one failed or not.
+    void warm(int owner, int index, const std::string& url, const std::string& path, int coverW = 0, int coverH = 0);
+
+    // Visible item range [first, last]; direction > 0 scrolling down, < 0 up, 0 unknown
+    void setViewport(int owner, int first, int last, int direction);
+
+    // Drop queued jobs and pending results (freeing their surfaces); results of in-flight jobs are discarded when they land
+    void cancel(int owner);
+
+    // Next finished download for owner, false when none
+    bool poll(int owner, Result& out);
+    bool hasResults(int owner);
+
+    // SDL event type pushed when an owner's first pending result lands, so a main loop blocked
+    // in SDL_WaitEventTimeout wakes up to upload it. Carries no data; (Uint32)-1 before any owner registers.
+    Uint32 resultEvent();
+
+    Stats stats();
+
+    // Stop and join the workers (app exit)
+    void shutdown();
+}
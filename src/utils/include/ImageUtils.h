@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include <SDL2/SDL.h>
+
+// CPU-side image work that is safe to run on worker threads: decoding and resampling produce
+// plain pixel surfaces so the render thread only has to upload them.
+namespace ImageUtils {
+    // Decode a JPEG/PNG/WebP/... file into an RGBA32 surface; nullptr on failure
+    SDL_Surface* loadRgba(const std::string& path);
+
+    // Center-crop an RGBA32 surface to the box's aspect ratio and area-downsample it to
+    // boxW x boxH (smaller images are cropped but not upscaled). Takes ownership of src and
+    // returns it unchanged when nothing needs doing.
+    SDL_Surface* coverFit(SDL_Surface* src, int boxW, int boxH);
+
+    // Compact thumbnail files (zlib-compressed pixels; RGB565 when the image is fully opaque).
+    // Loading one skips JPEG/WebP decoding and scaling. The loaded surface is RGBA32 or RGB565.
+    bool saveThumbnail(const std::string& path, SDL_Surface* rgba);
+    SDL_Surface* loadThumbnail(const std::string& path);
+
+    // Bytes of pixel data, used for upload budgets
+    inline size_t byteSize(const SDL_Surface* s) { return s ? (size_t)s->pitch * s->h : 0; }
+}
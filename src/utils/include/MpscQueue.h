@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <utility>
+
+// Unbounded lock-free multi-producer/single-consumer queue (Vyukov's linked list with a stub
+// node). Any thread may push; only one thread, the main loop, may pop. push never blocks and
+// never waits for the consumer, so worker threads hand results over without sharing a mutex
+// with the render thread. A pop racing a push may miss that item until the next pop.
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head(new Node()), tail(head.load()) {}
+    ~MpscQueue() {
+        T value;
+        while (pop(value)) {}
+        delete tail;
+    }
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void push(T value) {
+        Node* node = new Node();
+        node->value = std::move(value);
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer only
+    bool pop(T& out) {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        out = std::move(next->value);
+        delete tail;
+        tail = next; // next becomes the new stub; its value has been moved out
+        return true;
+    }
+
+    // Consumer only
+    bool empty() const { return tail->next.load(std::memory_order_acquire) == nullptr; }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value;
+    };
+    std::atomic<Node*> head;   // last pushed node, producers swap themselves in here
+    Node* tail;                // stub before the oldest unconsumed node
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <regex>
+
+// Compiled regexes shared across modules. Each pattern is built once, on first use or by
+// precompile() at startup (function-local statics are thread-safe), instead of being
+// recompiled at every call site.
+namespace Patterns {
+    // Console name normalization (StringUtils::normalizeConsoleName)
+    const std::regex& parenthesized();      // " (USA)"
+    const std::regex& bracketed();          // " [!]"
+    const std::regex& romIsoNoise();        // ROM/ROMs/ISO/&amp;/& and double spaces, icase
+    const std::regex& outerWhitespace();    // leading/trailing whitespace
+    const std::regex& spaceRuns();          // 2+ whitespace characters
+
+    // URLs
+    const std::regex& pageSuffix();         // "/page/N/" (Hexrom pagination), icase
+    const std::regex& romsConsolePath();    // "/roms/<console>" with the console captured
+    const std::regex& currentPageParam();   // "&currentpage=N"
+
+    // Characters not allowed in a saved ROM file name
+    const std::regex& unsafeFileNameChar();
+
+    // Build every pattern now so the first page parse doesn't pay for it
+    void precompile();
+}
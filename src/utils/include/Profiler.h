@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+// Frame-time instrumentation. Off by default and close to free when off (one atomic load per
+// scope). Turned on with PLUNDER_PROFILE=1 or by holding Select and pressing Start; while on,
+// an overlay shows p50/p95/p99 frame time over the last few seconds, draw calls, texture
+// memory and the most expensive scopes per frame.
+//
+// PLUNDER_TRACE=<file> also records every scope (from any thread) as a Chrome trace event and
+// writes the JSON to file on shutdown(); open it in chrome://tracing or ui.perfetto.dev.
+namespace Profiler {
+    // Read PLUNDER_PROFILE / PLUNDER_TRACE (call once at startup)
+    void init();
+
+    bool overlayVisible();
+    void toggleOverlay();
+
+    // Times the enclosing block under name, which must be a string literal
+    class Scope {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        const char* name;
+        long long startUs;             // -1 when profiling was off at construction
+    };
+
+    // Bracket one rendered frame (render thread)
+    void beginFrame();
+    void endFrame();
+
+    // Draws issued by the drawing helpers (QuadBatch, TextCache, Sprites, UiUtils shapes);
+    // plain SDL fills in screens are not counted
+    void countDrawCalls(int n);
+
+    // Current video memory of a texture pool (name must be a string literal)
+    void setTextureBytes(const char* pool, size_t bytes);
+
+    // Overlay in the top-left corner, drawn last in the frame when visible
+    void drawOverlay(SDL_Renderer* renderer, TTF_Font* font);
+
+    // Write the trace file, if tracing
+    void shutdown();
+}
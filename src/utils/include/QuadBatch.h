@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+
+// Collects textured quads and draws all quads sharing a texture with one SDL_RenderGeometry
+// call, instead of one SDL_RenderCopy (and one GL draw) per quad. Quads are drawn grouped by
+// texture in first-use order, so only batch quads that don't overlap each other. Falls back
+// to SDL_RenderCopy on SDL older than 2.0.18.
+class QuadBatch {
+public:
+    // Queue src of texture drawn into dst, modulated by color (alpha for fades)
+    void add(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst, SDL_Color color);
+
+    // Draw and empty the batch; returns the number of draw calls issued
+    int flush(SDL_Renderer* renderer);
+
+    bool empty() const { return batches.empty(); }
+    int quadCount() const { return quads; }
+
+private:
+    struct Batch {
+        SDL_Texture* texture;
+        float invW, invH;              // texel -> normalized texture coordinates
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+        std::vector<SDL_Rect> srcRects, dstRects; // fallback path
+        std::vector<SDL_Color> colors;
+    };
+    std::vector<Batch> batches;
+    int quads = 0;
+};
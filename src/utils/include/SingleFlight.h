@@ -0,0 +1,82 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "TaskPool.h"
+
+// Request coalescing: while a call for a key is running, further callers for the same key wait
+// for it and get a copy of its result instead of starting their own (the grid and a prefetch
+// asking for the same page, two tiles sharing a cover). Nothing is kept once the call returns;
+// caching stays with HttpCache and CachingScraper.
+template <typename V>
+class SingleFlight {
+public:
+    template <typename Fn>
+    V run(const std::string& key, Fn fn) {
+        for (;;) {
+            std::shared_ptr<Call> call;
+            bool leader = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto it = calls.find(key);
+                if (it == calls.end()) {
+                    call = std::make_shared<Call>();
+                    calls[key] = call;
+                    leader = true;
+                } else {
+                    call = it->second;
+                }
+            }
+            if (leader) return lead(key, call, fn);
+
+            std::unique_lock<std::mutex> lock(call->mutex);
+            // A cancelled waiter stops waiting, like HttpClient does mid-request
+            while (!call->done) {
+                if (TaskPool::cancelled()) return V();
+                call->ready.wait_for(lock, std::chrono::milliseconds(100));
+            }
+            // The leader's own task was cancelled, so its (empty) result says nothing about ours
+            if (!call->cancelled) return call->value;
+        }
+    }
+
+private:
+    struct Call {
+        std::mutex mutex;
+        std::condition_variable ready;
+        bool done = false;
+        bool cancelled = false;
+        V value;
+    };
+
+    template <typename Fn>
+    V lead(const std::string& key, const std::shared_ptr<Call>& call, Fn& fn) {
+        V value;
+        try {
+            value = fn();
+        } catch (...) {
+            finish(key, call, V());
+            throw;
+        }
+        finish(key, call, value);
+        return value;
+    }
+
+    void finish(const std::string& key, const std::shared_ptr<Call>& call, const V& value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            calls.erase(key);
+        }
+        std::lock_guard<std::mutex> lock(call->mutex);
+        call->value = value;
+        call->cancelled = TaskPool::cancelled();
+        call->done = true;
+        call->ready.notify_all();
+    }
+
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<Call>> calls;
+};
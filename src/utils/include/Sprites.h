@@ -0,0 +1,21 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+// Small shapes that used to be plotted pixel by pixel with SDL_RenderDrawPoint, rasterized once
+// per radius into white alpha textures and drawn as a few tinted quads. Blending matches what
+// the point plots produced with SDL_BLENDMODE_BLEND. Render thread only.
+namespace Sprites {
+    // Quarter discs of radius r hugging each corner of rect (pixels with dx*dx + dy*dy < r*r,
+    // measured from the corner pixel)
+    void drawCornerDiscs(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color color);
+
+    // The inverse: the part of each r x r corner square outside that quarter circle, used to
+    // round off the corners of an image drawn underneath
+    void drawCornerMask(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, SDL_Color color);
+
+    // Filled circle centered on (cx, cy) (pixels with dx*dx + dy*dy <= r*r)
+    void drawDisc(SDL_Renderer* renderer, int cx, int cy, int radius, SDL_Color color);
+
+    // Destroy cached textures (before the renderer goes away)
+    void clear();
+}
@@ -11,6 +11,12 @@ namespace StringUtils {
     // Clean HTML-ish text (decl; impl in .cpp)
     std::string cleanHtmlText(const std::string& input);
 
+    // Blacklist key for a console/game label: drops "(...)", "[...]", ROM(s)/ISO/&, trims, lowercases
+    std::string normalizeConsoleName(const std::string& name);
+
+    // "/roms/<console>" part of a site url, empty when there is none
+    std::string romsConsolePath(const std::string& url);
+
     // Split UTF-8 string into code point substrings (invalid bytes -> U+FFFD)
     std::vector<std::string> splitUtf8ToCodepoints(const std::string& str);
 
@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <SDL2/SDL.h>
+
+// Shared worker pool for one-off background jobs (scrapes, link lookups, downloads) that used
+// to get a detached std::thread each. A few workers take queued tasks highest priority first,
+// FIFO within a priority. Results come back to the main thread through typed completions
+// (run() below) drained by the main loop, instead of raw pointers in SDL_USEREVENTs.
+namespace TaskPool {
+    enum class Priority { Background, Normal, Interactive };
+
+    // Shared by whoever started a task and the task itself; copies share the flag. A task
+    // cancelled while queued never runs, one already running sees cancelled() (and its HTTP
+    // requests give up at their next wait), and its completion is dropped.
+    class CancelToken {
+    public:
+        CancelToken() : state(std::make_shared<State>()) {}
+        void cancel() const { state->flag.store(true); }
+        bool isCancelled() const {
+            for (const State* s = state.get(); s; s = s->parent.get())
+                if (s->flag.load()) return true;
+            return false;
+        }
+        // Cancelled with this token, or on its own (subtasks a task can drop without stopping itself)
+        CancelToken child() const {
+            CancelToken token;
+            token.state->parent = state;
+            return token;
+        }
+    private:
+        struct State {
+            std::atomic<bool> flag{false};
+            std::shared_ptr<State> parent;
+        };
+        std::shared_ptr<State> state;
+    };
+
+    void submit(Priority priority, const CancelToken& token, std::function<void()> work);
+
+    // True when the task running on the calling thread has been cancelled (always false off the pool)
+    bool cancelled();
+
+    // Token and priority of the task running on the calling thread, for subtasks it submits
+    // (a fresh token and Normal off the pool)
+    CancelToken currentToken();
+    Priority currentPriority();
+
+    // Run fn on the main thread at its next drainCompletions(), unless token is cancelled by then
+    void post(const CancelToken& token, std::function<void()> fn);
+
+    // Typed completion channel: work() runs on the pool, done(result) on the main thread
+    template <typename Work, typename Done>
+    void run(Priority priority, const CancelToken& token, Work work, Done done) {
+        submit(priority, token, [token, work, done]() {
+            auto result = std::make_shared<decltype(work())>(work());
+            if (token.isCancelled()) return;
+            post(token, [result, done]() { done(*result); });
+        });
+    }
+
+    // SDL event type pushed when completions are waiting, only to wake the main loop; carries no data
+    Uint32 completionEvent();
+
+    // Main thread, once per loop iteration: run waiting completions until budgetMs has passed
+    // (at least one). The handoff from workers is lock-free. Returns true if some are left over.
+    bool drainCompletions(Uint32 budgetMs);
+
+    // Cancel everything, then stop and join the workers (app exit)
+    void shutdown();
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+// Rendered-text and text-layout caches behind UiUtils' text functions (render thread only).
+//
+// Runs: each distinct (font, style, mode, wrap width, text) is rasterized once, in white, into
+// a shared TextureAtlas and tinted per draw, so steady-state frames do no TTF rendering and
+// create no textures. Whole runs are cached rather than single glyphs so output stays
+// pixel-identical to TTF_RenderText_* (kerning and bold overhang included). Least recently
+// used runs are evicted when the atlas fills up; runs too big for a page get their own texture.
+//
+// Layouts: word-wrap / clamp results keyed by (font, style, kind, text, width, lines).
+namespace TextCache {
+    enum class Mode { Solid, Blended, Wrapped };
+
+    struct Run {
+        SDL_Texture* texture = nullptr;
+        SDL_Rect rect = {0, 0, 0, 0};  // region of texture; w/h are the text size
+    };
+
+    // White rendering of text in the font's current style; false if TTF can't render it
+    bool get(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, Mode mode, int wrapWidth, Run& out);
+
+    // Draw run into dst tinted with color
+    void draw(SDL_Renderer* renderer, const Run& run, const SDL_Rect& dst, SDL_Color color);
+
+    // Cached layout (kind tells callers' algorithms apart), nullptr on miss
+    const std::vector<std::string>* findLayout(TTF_Font* font, char kind, const std::string& text, int width, int lines);
+    const std::vector<std::string>& storeLayout(TTF_Font* font, char kind, const std::string& text, int width, int lines,
+                                                std::vector<std::string> layout);
+
+    struct Stats {
+        unsigned long runHits = 0;
+        unsigned long runMisses = 0;   // TTF rasterizations
+        unsigned long runEvictions = 0;
+        unsigned long layoutHits = 0;
+        unsigned long layoutMisses = 0;
+    };
+    Stats stats();
+
+    // Destroy all textures (before the renderer goes away)
+    void clear();
+}
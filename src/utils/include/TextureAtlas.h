@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include <SDL2/SDL.h>
+
+// Packs many small images into a few large RGBA textures ("pages") so they can be drawn from
+// one texture in a single batch (see QuadBatch). Uses shelf packing: each page is split into
+// horizontal shelves sized by the first image placed on them. Released regions go on their
+// shelf's free list and are reused by images that fit, which suits same-sized thumbnails.
+class TextureAtlas {
+public:
+    struct Region {
+        int page = -1;
+        SDL_Rect rect = {0, 0, 0, 0};
+        bool valid() const { return page >= 0; }
+    };
+
+    TextureAtlas(int pageSize, int maxPages);
+    ~TextureAtlas();
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Pack and upload surface (any format); false when no page has room
+    bool insert(SDL_Renderer* renderer, SDL_Surface* surface, Region& out);
+    void release(const Region& region);
+
+    SDL_Texture* texture(int page) const { return page >= 0 && page < (int)pages.size() ? pages[page].texture : nullptr; }
+    int pageCount() const { return (int)pages.size(); }
+    int pageSize() const { return size; }
+    size_t bytes() const { return pages.size() * (size_t)size * size * 4; }
+
+    // Destroy every page
+    void clear();
+
+private:
+    struct Span { int x, w; };
+    struct Shelf {
+        int y, height;
+        int cursorX = 0;               // start of never-used space
+        int live = 0;
+        std::vector<Span> freeSpans;   // released regions left of cursorX
+    };
+    struct Page {
+        SDL_Texture* texture = nullptr;
+        std::vector<Shelf> shelves;
+        int nextShelfY = 0;
+        int live = 0;
+    };
+
+    bool place(Page& page, int w, int h, SDL_Rect& out);
+
+    int size;
+    int maxPages;
+    std::vector<Page> pages;
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+struct SDL_Color;
+
+// Plain RGBA color used by models and UiUtils. Kept free of SDL so scraper code (which fills
+// GameDetails fields) builds without it, e.g. in the host-side benchmarks.
+namespace UiUtils {
+    struct Color {
+        uint8_t r, g, b, a;
+        Color(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0, uint8_t a = 255) : r(r), g(g), b(b), a(a) {}
+        SDL_Color toSDLColor() const;
+    };
+}
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include "UiColor.h"
 
 
 // Draw a rounded rectangle with the given color and corner radius
@@ -12,12 +13,6 @@ void DrawRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, S
 
 
 namespace UiUtils {
-    struct Color {
-        uint8_t r, g, b, a;
-        Color(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0, uint8_t a = 255);
-        SDL_Color toSDLColor() const;
-    };
-
     void RenderTextCentered(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, const Color& color);
     void RenderText(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, const Color& color, float scale = 1.0f);
     void RenderTextWrapped(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, int x, int y, int maxWidth, const Color& color);